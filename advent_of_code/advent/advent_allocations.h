@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+// Counts heap allocations made through the global operator new, so each test can report how much it allocates.
+// The hooks are always linked in, but only count while tracking is enabled.
+namespace advent::allocations
+{
+	struct allocation_stats
+	{
+		int64_t num_allocations = 0;
+		int64_t bytes_allocated = 0;
+		int64_t peak_live_bytes = 0;
+	};
+
+	void set_tracking_enabled(bool enabled);
+	bool is_tracking_enabled();
+
+	// Zero every counter. Peak live bytes are measured from this point, so memory which was already allocated
+	// before the call doesn't count towards them. Freeing that memory later can't tell it apart from memory
+	// allocated since, so it comes off the live total, but never takes it below zero.
+	void reset_stats();
+
+	// Counts every allocation from every thread since the last reset_stats.
+	allocation_stats get_stats();
+}
\ No newline at end of file
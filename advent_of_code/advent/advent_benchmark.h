@@ -0,0 +1,78 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+
+#include "advent/advent_types.h"
+#include "advent/advent_test_result.h"
+#include "advent/advent_platform.h"
+#include "advent/advent_assert.h"
+#include "advent/advent_perf_counters.h"
+
+// Timing and reporting shared by the test runner and the stand-alone benchmark executables.
+
+std::string to_string(const ResultType& rt);
+
+std::string to_human_readable(std::chrono::hours time);
+std::string to_human_readable(std::chrono::minutes time);
+std::string to_human_readable(std::chrono::seconds time);
+std::string to_human_readable(std::chrono::milliseconds time);
+std::string to_human_readable(std::chrono::microseconds time);
+std::string to_human_readable(std::chrono::nanoseconds time);
+
+benchmark_stats calculate_benchmark_stats(std::vector<std::chrono::nanoseconds> samples);
+std::string to_string(const benchmark_stats& stats);
+
+// What advent::allocations counted since the last reset, averaged over num_runs (apart from the peak).
+std::vector<test_counter> get_allocation_counters(int64_t num_runs);
+std::string to_string(const std::vector<test_counter>& counters);
+
+// Collects allocation and hardware counters between construction and stop(). Either kind can be left off.
+// Allocation tracking must already be enabled for allocations to be counted.
+class benchmark_counters
+{
+	std::optional<advent::perf_counters> m_perf_counters;
+	bool m_track_allocations = false;
+public:
+	benchmark_counters(bool track_allocations, bool hardware_counters);
+	// num_runs is how many times the code being measured ran, so allocations and hardware counters can be reported per run.
+	std::vector<test_counter> stop(std::size_t num_runs);
+};
+
+// Calls func once and times it. func must return a ResultType.
+template <typename Func>
+std::pair<ResultType, std::chrono::nanoseconds> time_function(Func&& func)
+{
+	const auto start_time = std::chrono::high_resolution_clock::now();
+	const ResultType res = func();
+	advent::platform::do_not_optimise(res);
+	const auto end_time = std::chrono::high_resolution_clock::now();
+	return std::pair{ res, end_time - start_time };
+}
+
+// Calls func num_warmups times untimed, then times it num_repetitions times. Returns the last result.
+template <typename Func>
+std::pair<ResultType, benchmark_stats> benchmark_function(Func&& func, std::size_t num_warmups, std::size_t num_repetitions)
+{
+	AdventCheck(num_repetitions > 0u);
+	ResultType res;
+	for (std::size_t i = 0u; i < num_warmups; ++i)
+	{
+		res = time_function(func).first;
+	}
+
+	std::vector<std::chrono::nanoseconds> samples;
+	samples.reserve(num_repetitions);
+	for (std::size_t i = 0u; i < num_repetitions; ++i)
+	{
+		auto [latest_res, time_taken] = time_function(func);
+		samples.push_back(time_taken);
+		res = std::move(latest_res);
+	}
+	return std::pair{ std::move(res), calculate_benchmark_stats(std::move(samples)) };
+}
\ No newline at end of file
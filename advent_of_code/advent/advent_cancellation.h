@@ -0,0 +1,108 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+// Cooperative cancellation for tests which run for too long.
+// The test runner gives each test a flag which its watchdog sets when the time budget runs out. Long-running loops
+// should call advent::throw_if_cancelled() now and then, which throws advent::test_cancelled once the flag is set.
+// Code that runs inside a parallel algorithm must not throw, and doesn't run on the test's own thread, so capture
+// a cancellation_token first and check is_cancelled() on that instead.
+namespace advent
+{
+	class test_cancelled {};
+
+	class cancellation_token
+	{
+		const std::atomic_bool* m_flag = nullptr;
+	public:
+		cancellation_token() noexcept = default;
+		explicit cancellation_token(const std::atomic_bool* flag) noexcept : m_flag{ flag } {}
+		bool is_cancelled() const noexcept { return m_flag != nullptr && m_flag->load(std::memory_order_relaxed); }
+		void throw_if_cancelled() const
+		{
+			if (is_cancelled()) [[unlikely]]
+			{
+				throw test_cancelled{};
+			}
+		}
+	};
+
+	namespace cancellation_internal
+	{
+		inline thread_local cancellation_token current_token;
+	}
+
+	// The token for the test running on this thread. Never cancelled if there isn't one.
+	inline cancellation_token get_cancellation_token() noexcept
+	{
+		return cancellation_internal::current_token;
+	}
+
+	inline bool is_cancelled() noexcept
+	{
+		return cancellation_internal::current_token.is_cancelled();
+	}
+
+	inline void throw_if_cancelled()
+	{
+		cancellation_internal::current_token.throw_if_cancelled();
+	}
+
+	// Makes token the current thread's cancellation token until the scope ends.
+	class cancellation_scope
+	{
+		cancellation_token m_previous_token;
+	public:
+		explicit cancellation_scope(cancellation_token token) noexcept
+			: m_previous_token{ std::exchange(cancellation_internal::current_token, token) } {}
+		~cancellation_scope() { cancellation_internal::current_token = m_previous_token; }
+		cancellation_scope(const cancellation_scope&) = delete;
+		cancellation_scope& operator=(const cancellation_scope&) = delete;
+	};
+
+	// A single thread which sets each watched flag once its deadline passes.
+	class watchdog
+	{
+		using clock = std::chrono::steady_clock;
+		struct deadline_entry
+		{
+			uint64_t watch_id;
+			std::atomic_bool* flag;
+		};
+		std::mutex m_mutex;
+		std::condition_variable m_signal;
+		// Only the watchdog thread removes entries once they have fired, so watches look theirs up by ID rather than
+		// holding on to an iterator that may no longer be valid.
+		std::multimap<clock::time_point, deadline_entry> m_deadlines;
+		uint64_t m_next_watch_id = 0u;
+		bool m_stopping = false;
+		std::thread m_thread;
+
+		void run();
+	public:
+		watchdog();
+		~watchdog();
+		watchdog(const watchdog&) = delete;
+		watchdog& operator=(const watchdog&) = delete;
+
+		// Sets flag when time_limit has passed, unless the returned watch has been destroyed by then.
+		class watch
+		{
+			watchdog* m_owner;
+			clock::time_point m_deadline;
+			uint64_t m_id;
+		public:
+			watch(watchdog& owner, std::atomic_bool& flag, clock::duration time_limit);
+			~watch();
+			watch(const watch&) = delete;
+			watch& operator=(const watch&) = delete;
+		};
+	};
+}
\ No newline at end of file
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <charconv>
+#include <concepts>
+#include <optional>
+#include <string_view>
+
+namespace advent
+{
+	// Reads a number given on the command line. Returns nullopt unless the whole argument is a valid T,
+	// so the caller can print its usage message instead of throwing from std::stoi and friends.
+	template <typename T> requires std::integral<T> || std::floating_point<T>
+	std::optional<T> parse_command_line_value(std::string_view arg)
+	{
+		T value{};
+		const char* const last = arg.data() + arg.size();
+		const std::from_chars_result result = std::from_chars(arg.data(), last, value);
+		if (arg.empty() || result.ec != std::errc{} || result.ptr != last)
+		{
+			return std::nullopt;
+		}
+		return value;
+	}
+}
\ No newline at end of file
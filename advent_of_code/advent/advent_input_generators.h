@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <cstdint>
+
+// Synthetic puzzle inputs for benchmarking solutions on inputs bigger than the real ones.
+namespace advent
+{
+	// The seed used when none is given, so two benchmark runs see exactly the same inputs.
+	constexpr uint64_t default_generator_seed = 20241225u;
+
+	// Returns true if generate_input supports the day. Every solved day is supported except 17 and 24, whose inputs
+	// can't get any bigger. Days 21 and 25 aren't solved, so there's nothing to benchmark.
+	bool can_generate_input(int day);
+
+	// Why there's no generator for the day, or an empty string if there is one.
+	std::string_view get_missing_generator_reason(int day);
+
+	// Returns a valid input for the day, roughly the size of a real puzzle input at scale 1.
+	// Grids get scale times as wide and tall. Lists (robots, merchants, moves, the disk map) get scale times as long.
+	// Day 23 is limited by its two letter computer names, so it stops growing at 676 computers. Day 8's roof stops
+	// growing at 64 wide, because the solution stores coordinates in an int8_t, and gets more antennas instead.
+	// Equations, reports, claw machines, stones, updates and designs get scale times as many.
+	// The same day, scale and seed always give the same input.
+	std::string generate_input(int day, int scale, uint64_t seed = default_generator_seed);
+}
\ No newline at end of file
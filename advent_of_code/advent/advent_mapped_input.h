@@ -0,0 +1,31 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <cstddef>
+
+namespace advent
+{
+	// A whole file mapped read-only into memory. The contents can be read through view() without being copied,
+	// for as long as the mapped_input exists.
+	class mapped_input
+	{
+		const char* m_data = nullptr;
+		std::size_t m_size = 0u;
+		void release() noexcept;
+	public:
+		explicit mapped_input(const std::string& filename);
+		mapped_input(mapped_input&& other) noexcept;
+		mapped_input& operator=(mapped_input&& other) noexcept;
+		mapped_input(const mapped_input&) = delete;
+		mapped_input& operator=(const mapped_input&) = delete;
+		~mapped_input();
+
+		std::string_view view() const noexcept { return std::string_view{ m_data, m_size }; }
+		std::size_t size() const noexcept { return m_size; }
+		bool empty() const noexcept { return m_size == 0u; }
+	};
+
+	// Maps the file with the name "adventX/adventX.txt"
+	mapped_input open_mapped_puzzle_input(int day);
+}
\ No newline at end of file
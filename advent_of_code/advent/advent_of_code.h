@@ -1,6 +1,65 @@
 #pragma once
 
+#include <string>
 #include <string_view>
 #include <vector>
+#include <cstddef>
+#include <chrono>
 
-bool verify_all(const std::vector<std::string_view>& filters);
\ No newline at end of file
+struct verification_options
+{
+	// Only run tests with one of these in their name. Leave empty to run everything.
+	std::vector<std::string_view> filters;
+
+	// How many tests to run at once. 1 runs everything in order on the main thread.
+	std::size_t num_jobs = 1u;
+
+	// Benchmark mode runs each test benchmark_warmups times untimed, then times it benchmark_repetitions times
+	// and reports statistics over those samples. Benchmarks always run one at a time on a single pinned core.
+	bool benchmark = false;
+	std::size_t benchmark_warmups = 3u;
+	std::size_t benchmark_repetitions = 20u;
+
+	// Count heap allocations made by each test and report them with the results. Tests run one at a time
+	// so the counts don't get mixed up.
+	bool track_allocations = false;
+
+	// Read hardware performance counters around each test. Only supported on Linux, and silently skipped
+	// if the counters can't be opened.
+	bool hardware_counters = false;
+
+	// Run each test in its own forked process and report the child's peak resident memory and page faults.
+	// Tests run one at a time, and nothing is cached between them. Only supported on POSIX systems.
+	bool isolate = false;
+
+	// If set, a test which runs for longer than this is cancelled and reported as a TIMEOUT. Tests only stop
+	// early if they call advent::throw_if_cancelled(); otherwise they are reported once they finish.
+	std::chrono::milliseconds timeout{ 0 };
+
+	// If set, write the results of every test that ran to these files.
+	std::string json_output_path;
+	std::string csv_output_path;
+
+	// If set, compare against results previously written with json_output_path. Any test which took more than
+	// (1 + regression_threshold) times as long as the baseline counts as a failure.
+	std::string baseline_path;
+	double regression_threshold = 0.1;
+};
+
+bool verify_all(const std::vector<std::string_view>& filters);
+bool verify_all(const verification_options& options);
+
+struct batch_options
+{
+	int day = 0;
+	int part = 0;
+
+	// Either a directory, to use every file in it, or a file name where the last part may contain * and ? wildcards.
+	std::string input_pattern;
+
+	std::size_t num_jobs = 1u;
+};
+
+// Runs one day's solution on every file matching the pattern, printing each result as it finishes and then
+// the overall throughput. Returns false if there was nothing to run or any file failed.
+bool run_batch(const batch_options& options);
\ No newline at end of file
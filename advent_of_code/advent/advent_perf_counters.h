@@ -0,0 +1,34 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "advent/advent_test_result.h"
+
+namespace advent
+{
+	// Hardware performance counters (cycles, instructions, cache and branch misses) for the calling thread.
+	// Threads it starts while counting inherit the counters, but the kernel only adds a child thread's counts to
+	// these when that thread exits. So work done on threads which are still running at stop(), such as the pool
+	// behind the parallel standard algorithms, isn't counted.
+	// Only supported on Linux through perf_event_open. Anywhere else, or when the kernel refuses (e.g. in a
+	// container without perf permissions), nothing is counted and stop() returns no counters.
+	class perf_counters
+	{
+		static constexpr std::size_t num_counters = 5u;
+		std::array<int, num_counters> m_handles;
+	public:
+		perf_counters();
+		perf_counters(const perf_counters&) = delete;
+		perf_counters& operator=(const perf_counters&) = delete;
+		~perf_counters();
+
+		bool is_available() const noexcept;
+
+		// Zero and start every available counter.
+		void start();
+
+		// Stop counting and read every counter which could be opened.
+		std::vector<test_counter> stop();
+	};
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <functional>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// Wrappers around the few OS-specific calls the test runner needs.
+namespace advent::platform
+{
+	// Total CPU time (user and kernel) used so far by every thread in this process.
+	std::chrono::nanoseconds get_process_cpu_time();
+
+	// Restrict the calling thread to a single core so benchmark samples aren't skewed by migrations.
+	// Returns false if this isn't supported here.
+	bool pin_current_thread_to_core(std::size_t core_idx);
+
+	// The core benchmarks should pin to: the last one this process is allowed to run on, which is the one the OS
+	// is least likely to be using. Cores outside the process's affinity mask (e.g. under taskset or a container's
+	// CPU limit) are never picked.
+	std::size_t get_benchmark_core();
+
+	// Undo pin_current_thread_to_core and let the thread run anywhere again.
+	void unpin_current_thread();
+
+	struct child_process_result
+	{
+		// False if the child crashed, was killed, or couldn't be started. output is then whatever arrived before that.
+		bool completed = false;
+		std::string output;
+		int64_t max_rss_bytes = 0;
+		int64_t major_page_faults = 0;
+		int64_t minor_page_faults = 0;
+	};
+
+	// Whether run_in_child_process can fork here. Only POSIX systems can.
+	bool can_run_in_child_process();
+
+	// Forks, calls work in the child and sends back the string it returns. Peak memory and page faults are the
+	// child's alone, so they aren't hidden by whatever this process did before. Only the calling thread exists in
+	// the child, so don't call this while other threads might be holding locks that work needs.
+	child_process_result run_in_child_process(const std::function<std::string()>& work);
+
+	// Make the compiler assume the value is used, so the work producing it can't be optimised away.
+	template <typename T>
+	inline void do_not_optimise(const T& value)
+	{
+#ifdef _MSC_VER
+		static const volatile void* sink = nullptr;
+		sink = &value;
+		_ReadWriteBarrier();
+#else
+		asm volatile("" : : "r"(&value) : "memory");
+#endif
+	}
+}
\ No newline at end of file
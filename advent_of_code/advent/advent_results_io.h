@@ -0,0 +1,37 @@
+#pragma once
+
+#include <iosfwd>
+#include <span>
+#include <string>
+#include <vector>
+#include <chrono>
+
+#include "advent/advent_test_result.h"
+
+// Machine-readable output of test results, and comparison against a previous run.
+namespace advent::results_io
+{
+	// Filtered tests are left out of both formats.
+	void write_json(std::ostream& output, std::span<const test_result> results);
+	void write_csv(std::ostream& output, std::span<const test_result> results);
+
+	// A test's timing as recorded by write_json in an earlier run.
+	struct baseline_entry
+	{
+		std::string name;
+		std::chrono::nanoseconds time{};
+	};
+
+	std::vector<baseline_entry> read_json_baseline(std::istream& input);
+
+	struct regression
+	{
+		std::string name;
+		std::chrono::nanoseconds baseline_time{};
+		std::chrono::nanoseconds current_time{};
+	};
+
+	// Finds tests which took more than (1 + threshold) times as long as they did in the baseline.
+	// Tests missing from either side are ignored.
+	std::vector<regression> find_regressions(std::span<const test_result> results, std::span<const baseline_entry> baseline, double threshold);
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <cstddef>
+#include <cstdint>
+
+// A long-lived process which runs solutions on request over a local (Unix domain) socket, so repeated runs don't
+// pay for process startup and days can keep caches warm between requests. Only supported on POSIX systems.
+//
+// Protocol. All integers are little-endian. A client may send any number of requests on one connection, without
+// waiting for the answers; they may be solved at the same time, but the responses come back in request order.
+//     Request : uint32 day, uint32 part, uint64 input_size, then input_size bytes of puzzle input.
+//               Day 0 asks the server to shut down; it is answered, and the server stops accepting connections.
+//     Response: uint32 status (0 for success, 1 for failure), uint64 size, then size bytes holding the answer
+//               or the error message.
+namespace advent
+{
+	struct server_options
+	{
+		std::string socket_path;
+
+		// How many requests are solved at once, across all connections. Each connection also gets a thread of its
+		// own to read requests on, so idle clients don't hold up anyone else.
+		std::size_t num_jobs = 1u;
+	};
+
+	// Serves requests until a client asks it to shut down. Returns false if the socket could not be opened.
+	bool run_server(const server_options& options);
+
+	struct server_response
+	{
+		bool succeeded = false;
+		std::string result;
+	};
+
+	// Connects to a running server, sends one request and waits for the answer.
+	// Throws advent::test_failed if the server can't be reached.
+	server_response send_server_request(const std::string& socket_path, int day, int part, std::string_view input);
+
+	// Asks a running server to shut down.
+	void send_server_shutdown(const std::string& socket_path);
+}
\ No newline at end of file
@@ -5,9 +5,11 @@
 #include "advent_headers.h"
 #include "advent_solutions.h"
 
+#include <array>
+#include <string_view>
 #include <vector>
 
-static const verification_test tests[] =
+static constexpr verification_test tests[] =
 {
 	TESTCASE_WITH_ARG(day_one_p1_a, DAY_ONE_A, 11),
 	TESTCASE_WITH_ARG(day_one_p2_a, DAY_ONE_A, 31),
@@ -238,6 +240,16 @@ static const verification_test tests[] =
 	DAY(twentyfive, DAY_25_1_SOLUTION,"MERRY CHRISTMAS!")
 };
 
+// Names of the slowest tests, slowest first. When running with --jobs these get started before everything else.
+static constexpr std::array long_running_tests =
+{
+	std::string_view{ "advent_six_p2" },
+	std::string_view{ "advent_twentytwo_p2" },
+	std::string_view{ "advent_seven_p2" },
+	std::string_view{ "advent_twenty_p2" },
+	std::string_view{ "advent_sixteen_p2" }
+};
+
 #undef ARG
 #undef TESTCASE
 #undef FUNC_NAME
@@ -26,20 +26,22 @@ Define inline definitions of test inputs here for use in the testcases.
 
 For example:
 
-test_data TEST_ONE_A = "test1_input";
+constexpr test_data TEST_ONE_A = "test1_input";
 
 Use can also combine strings together with combine_inputs, for example, which will also add newlinse automatically using the template parameter to decide how many:
 
-test_data TEST_ONE_B = "test2";
-static const auto TEST_ONE = advent::combine_inputs<2>(TEST_ONE_A, TEST_ONE_B);
+constexpr test_data TEST_ONE_B = "test2";
+constexpr test_data TEST_ONE = advent::combine_inputs<2>(TEST_ONE_A, TEST_ONE_B);
 will set TEXT_ONE to "test1_input\n\ntest2"
 
+Inputs must be constexpr, because the table of tests in advent_setup.h is built at compile time.
+
 */
 
 template <std::size_t S>
 using test_data = advent::consteval_string<S>;
 
-test_data DAY_ONE_A{
+constexpr test_data DAY_ONE_A{
 R"(3   4
 4   3
 2   5
@@ -47,25 +49,25 @@ R"(3   4
 3   9
 3   3)" };
 
-test_data DAY_TWO_A = "7 6 4 2 1";
-test_data DAY_TWO_B = "1 2 7 8 9";
-test_data DAY_TWO_C = "9 7 6 2 1";
-test_data DAY_TWO_D = "1 3 2 4 5";
-test_data DAY_TWO_E = "8 6 4 4 1";
-test_data DAY_TWO_F = "1 3 6 7 9";
-test_data DAY_TWO_G = advent::combine_inputs<1>(DAY_TWO_A, DAY_TWO_B, DAY_TWO_C, DAY_TWO_D, DAY_TWO_E, DAY_TWO_F);
+constexpr test_data DAY_TWO_A = "7 6 4 2 1";
+constexpr test_data DAY_TWO_B = "1 2 7 8 9";
+constexpr test_data DAY_TWO_C = "9 7 6 2 1";
+constexpr test_data DAY_TWO_D = "1 3 2 4 5";
+constexpr test_data DAY_TWO_E = "8 6 4 4 1";
+constexpr test_data DAY_TWO_F = "1 3 6 7 9";
+constexpr test_data DAY_TWO_G = advent::combine_inputs<1>(DAY_TWO_A, DAY_TWO_B, DAY_TWO_C, DAY_TWO_D, DAY_TWO_E, DAY_TWO_F);
 
-test_data DAY_THREE_A = "xmul(2,4)%&mul[3,7]!@^do_not_mul(5,5)+mul(32,64]then(mul(11,8)mul(8,5))";
-test_data DAY_THREE_B = "xmul(2,4)&mul[3,7]!^don't()_mul(5,5)+mul(32,64](mul(11,8)undo()?mul(8,5))";
+constexpr test_data DAY_THREE_A = "xmul(2,4)%&mul[3,7]!@^do_not_mul(5,5)+mul(32,64]then(mul(11,8)mul(8,5))";
+constexpr test_data DAY_THREE_B = "xmul(2,4)&mul[3,7]!^don't()_mul(5,5)+mul(32,64](mul(11,8)undo()?mul(8,5))";
 
-test_data DAY_FOUR_A =
+constexpr test_data DAY_FOUR_A =
 R"(..X...
 .SAMX.
 .A..A.
 XMAS.S
 .X....)";
 
-test_data DAY_FOUR_B =
+constexpr test_data DAY_FOUR_B =
 R"(MMMSXXMASM
 MSAMXMSMSA
 AMXSXMAAMM
@@ -77,7 +79,7 @@ SAXAMASAAA
 MAMMMXMMMM
 MXMXAXMASX)";
 
-test_data DAY_FOUR_C =
+constexpr test_data DAY_FOUR_C =
 R"(MMMSXXMASM
 MSAMXMSMSA
 AMXSXMAAMM
@@ -89,12 +91,12 @@ SAXAMASAAA
 MAMMMXMMMM
 MXMXAXMASX)";
 
-test_data DAY_FOUR_D =
+constexpr test_data DAY_FOUR_D =
 R"(M.S
 .A.
 M.S)";
 
-test_data DAY_FOUR_E =
+constexpr test_data DAY_FOUR_E =
 R"(.M.S......
 ..A..MSMS.
 .M.S.MAA..
@@ -106,7 +108,7 @@ S.S.S.S.S.
 M.M.M.M.M.
 ..........)";
 
-test_data DAY_FIVE_A =
+constexpr test_data DAY_FIVE_A =
 R"(47|53
 97|13
 97|61
@@ -136,7 +138,7 @@ R"(47|53
 61,13,29
 97,13,75,29,47)";
 
-test_data DAY_SIX_A =
+constexpr test_data DAY_SIX_A =
 R"(....#.....
 .........#
 ..........
@@ -148,19 +150,19 @@ R"(....#.....
 #.........
 ......#...)";
 
-test_data DAY_SEVEN_A = "190: 10 19";
-test_data DAY_SEVEN_B = "3267 : 81 40 27";
-test_data DAY_SEVEN_C = "83 : 17 5";
-test_data DAY_SEVEN_D = "156 : 15 6";
-test_data DAY_SEVEN_E = "7290 : 6 8 6 15";
-test_data DAY_SEVEN_F = "161011 : 16 10 13";
-test_data DAY_SEVEN_G = "192 : 17 8 14";
-test_data DAY_SEVEN_H = "21037 : 9 7 18 13";
-test_data DAY_SEVEN_I = "292 : 11 6 16 20";
+constexpr test_data DAY_SEVEN_A = "190: 10 19";
+constexpr test_data DAY_SEVEN_B = "3267 : 81 40 27";
+constexpr test_data DAY_SEVEN_C = "83 : 17 5";
+constexpr test_data DAY_SEVEN_D = "156 : 15 6";
+constexpr test_data DAY_SEVEN_E = "7290 : 6 8 6 15";
+constexpr test_data DAY_SEVEN_F = "161011 : 16 10 13";
+constexpr test_data DAY_SEVEN_G = "192 : 17 8 14";
+constexpr test_data DAY_SEVEN_H = "21037 : 9 7 18 13";
+constexpr test_data DAY_SEVEN_I = "292 : 11 6 16 20";
 
-test_data DAY_SEVEN_J =  advent::combine_inputs<1>(DAY_SEVEN_A, DAY_SEVEN_B, DAY_SEVEN_C, DAY_SEVEN_D, DAY_SEVEN_E, DAY_SEVEN_F, DAY_SEVEN_G, DAY_SEVEN_H, DAY_SEVEN_I);
+constexpr test_data DAY_SEVEN_J =  advent::combine_inputs<1>(DAY_SEVEN_A, DAY_SEVEN_B, DAY_SEVEN_C, DAY_SEVEN_D, DAY_SEVEN_E, DAY_SEVEN_F, DAY_SEVEN_G, DAY_SEVEN_H, DAY_SEVEN_I);
 
-test_data DAY_EIGHT_A =
+constexpr test_data DAY_EIGHT_A =
 R"(............
 ........0...
 .....0......
@@ -174,13 +176,13 @@ R"(............
 ............
 ............)";
 
-test_data DAY_TEN_A =
+constexpr test_data DAY_TEN_A =
 R"(0123
 1234
 8765
 9876)";
 
-test_data DAY_TEN_B =
+constexpr test_data DAY_TEN_B =
 R"(...0...
 ...1...
 ...2...
@@ -189,7 +191,7 @@ R"(...0...
 8.....8
 9.....9)";
 
-test_data DAY_TEN_C =
+constexpr test_data DAY_TEN_C =
 R"(..90..9
 ...1.98
 ...2..7
@@ -198,7 +200,7 @@ R"(..90..9
 876....
 987....)";
 
-test_data DAY_TEN_D =
+constexpr test_data DAY_TEN_D =
 R"(10..9..
 2...8..
 3...7..
@@ -207,7 +209,7 @@ R"(10..9..
 ...9..2
 .....01)";
 
-test_data DAY_TEN_E =
+constexpr test_data DAY_TEN_E =
 R"(89010123
 78121874
 87430965
@@ -217,7 +219,7 @@ R"(89010123
 01329801
 10456732)";
 
-test_data DAY_TEN_F =
+constexpr test_data DAY_TEN_F =
 R"(.....0.
 ..4321.
 ..5..2.
@@ -226,7 +228,7 @@ R"(.....0.
 ..8765.
 ..9....)";
 
-test_data DAY_TEN_G =
+constexpr test_data DAY_TEN_G =
 R"(..90..9
 ...1.98
 ...2..7
@@ -235,7 +237,7 @@ R"(..90..9
 876....
 987....)";
 
-test_data DAY_TEN_H =
+constexpr test_data DAY_TEN_H =
 R"(012345
 123456
 234567
@@ -243,25 +245,25 @@ R"(012345
 4.6789
 56789.)";
 
-test_data DAY_ELEVEN_A = "0 1 10 99 999";
-test_data DAY_ELEVEN_A_1 = "1 2024 1 0 9 9 2021976";
+constexpr test_data DAY_ELEVEN_A = "0 1 10 99 999";
+constexpr test_data DAY_ELEVEN_A_1 = "1 2024 1 0 9 9 2021976";
 
-test_data DAY_ELEVEN_B = "125 17";
+constexpr test_data DAY_ELEVEN_B = "125 17";
 
-test_data DAY_TWELVE_A =
+constexpr test_data DAY_TWELVE_A =
 R"(AAAA
 BBCD
 BBCC
 EEEC)";
 
-test_data DAY_TWELVE_B =
+constexpr test_data DAY_TWELVE_B =
 R"(OOOOO
 OXOXO
 OOOOO
 OXOXO
 OOOOO)";
 
-test_data DAY_TWELVE_C =
+constexpr test_data DAY_TWELVE_C =
 R"(RRRRIICCFF
 RRRRIICCCF
 VVRRRCCFFF
@@ -273,14 +275,14 @@ MIIIIIJJEE
 MIIISIJEEE
 MMMISSJEEE)";
 
-test_data DAY_TWELVE_D =
+constexpr test_data DAY_TWELVE_D =
 R"(EEEEE
 EXXXX
 EEEEE
 EXXXX
 EEEEE)";
 
-test_data DAY_TWELVE_E =
+constexpr test_data DAY_TWELVE_E =
 R"(AAAAAA
 AAABBA
 AAABBA
@@ -288,25 +290,25 @@ ABBAAA
 ABBAAA
 AAAAAA)";
 
-test_data DAY_THIRTEEN_A = R"(Button A: X+94, Y+34
+constexpr test_data DAY_THIRTEEN_A = R"(Button A: X+94, Y+34
 Button B: X+22, Y+67
 Prize: X=8400, Y=5400)";
 
-test_data DAY_THIRTEEN_B = R"(Button A: X+26, Y+66
+constexpr test_data DAY_THIRTEEN_B = R"(Button A: X+26, Y+66
 Button B: X+67, Y+21
 Prize: X=12748, Y=12176)";
 
-test_data DAY_THIRTEEN_C = R"(Button A: X+17, Y+86
+constexpr test_data DAY_THIRTEEN_C = R"(Button A: X+17, Y+86
 Button B: X+84, Y+37
 Prize: X=7870, Y=6450)";
 
-test_data DAY_THIRTEEN_D = R"(Button A: X+69, Y+23
+constexpr test_data DAY_THIRTEEN_D = R"(Button A: X+69, Y+23
 Button B: X+27, Y+71
 Prize: X=18641, Y=10279)";
 
-test_data DAY_THIRTEEN_E = advent::combine_inputs<2>(DAY_THIRTEEN_A, DAY_THIRTEEN_B, DAY_THIRTEEN_C, DAY_THIRTEEN_D);
+constexpr test_data DAY_THIRTEEN_E = advent::combine_inputs<2>(DAY_THIRTEEN_A, DAY_THIRTEEN_B, DAY_THIRTEEN_C, DAY_THIRTEEN_D);
 
-test_data DAY_FIFTEEN_A =
+constexpr test_data DAY_FIFTEEN_A =
 R"(########
 #..O.O.#
 ##@.O..#
@@ -318,7 +320,7 @@ R"(########
 
 <^^>>>vv<v>>v<<)";
 
-test_data DAY_FIFTEEN_B =
+constexpr test_data DAY_FIFTEEN_B =
 R"(##########
 #..O..O.O#
 #......O.#
@@ -341,7 +343,7 @@ vvv<<^>^v^^><<>>><>^<<><^vv^^<>vvv<>><^^v>^>vv<>v<<<<v<^v>^<^^>>>^<v<v
 ^^>vv<^v^v<vv>^<><v<^v>^^^>>>^^vvv^>vvv<>>>^<^>>>>>^<<^v>^vvv<>^<><<v>
 v^^>>><<^^<>>^v^<v^vv<>v^<<>^<^v^v><^<<<><<^<v><v<>vv>>v><v^<vv<>v^<<^)";
 
-test_data DAY_FIFTEEN_C =
+constexpr test_data DAY_FIFTEEN_C =
 R"(#######
 #...#.#
 #.....#
@@ -352,7 +354,7 @@ R"(#######
 
 <vv<<^^<<^^)";
 
-test_data DAY_SIXTEEN_A =
+constexpr test_data DAY_SIXTEEN_A =
 R"(###############
 #.......#....E#
 #.#.###.#.###.#
@@ -369,7 +371,7 @@ R"(###############
 #S..#.....#...#
 ###############)";
 
-test_data DAY_SIXTEEN_B =
+constexpr test_data DAY_SIXTEEN_B =
 R"(#################
 #...#...#...#..E#
 #.#.#.#.#.#.#.#.#
@@ -388,49 +390,49 @@ R"(#################
 #S#.............#
 #################)";
 
-test_data DAY_SEVENTEEN_A =
+constexpr test_data DAY_SEVENTEEN_A =
 R"(Register A: 0
 Register B: 0
 Register C: 9
 
 Program: 2,6)";
 
-test_data DAY_SEVENTEEN_B =
+constexpr test_data DAY_SEVENTEEN_B =
 R"(Register A: 10
 Register B: 0
 Register C: 0
 
 Program: 5,0,5,1,5,4)";
 
-test_data DAY_SEVENTEEN_C =
+constexpr test_data DAY_SEVENTEEN_C =
 R"(Register A: 2024
 Register B: 0
 Register C: 0
 
 Program: 0,1,5,4,3,0)";
 
-test_data DAY_SEVENTEEN_D =
+constexpr test_data DAY_SEVENTEEN_D =
 R"(Register A: 0
 Register B: 29
 Register C: 0
 
 Program: 1,7)";
 
-test_data DAY_SEVENTEEN_E =
+constexpr test_data DAY_SEVENTEEN_E =
 R"(Register A: 0
 Register B: 2024
 Register C: 43690
 
 Program: 4,0)";
 
-test_data DAY_SEVENTEEN_F =
+constexpr test_data DAY_SEVENTEEN_F =
 R"(Register A: 729
 Register B: 0
 Register C: 0
 
 Program: 0,1,5,4,3,0)";
 
-test_data DAY_EIGHTEEN_A =
+constexpr test_data DAY_EIGHTEEN_A =
 R"(5,4
 4,2
 4,5
@@ -457,7 +459,7 @@ R"(5,4
 1,6
 2,0)";
 
-test_data DAY_NINETEEN_HEADER = "r, wr, b, g, bwu, rb, gb, br";
+constexpr test_data DAY_NINETEEN_HEADER = "r, wr, b, g, bwu, rb, gb, br";
 
 template <typename...Lines>
 inline constexpr auto day_19_make_testcase(auto header, Lines...lines)
@@ -466,24 +468,24 @@ inline constexpr auto day_19_make_testcase(auto header, Lines...lines)
 	return advent::combine_inputs<2>(header, body);
 }
 
-test_data DAY_NINETEEN_LINE_A = "brwrr";
-test_data DAY_NINETEEN_LINE_B = "bggr";
-test_data DAY_NINETEEN_LINE_C = "gbbr";
-test_data DAY_NINETEEN_LINE_D = "rrbgbr";
-test_data DAY_NINETEEN_LINE_E = "ubwu";
-test_data DAY_NINETEEN_LINE_F = "bwurrg";
-test_data DAY_NINETEEN_LINE_G = "brgr";
-test_data DAY_NINETEEN_LINE_H = "bbrgwb";
-
-test_data DAY_NINETEEN_A = day_19_make_testcase(DAY_NINETEEN_HEADER, DAY_NINETEEN_LINE_A);
-test_data DAY_NINETEEN_B = day_19_make_testcase(DAY_NINETEEN_HEADER, DAY_NINETEEN_LINE_B);
-test_data DAY_NINETEEN_C = day_19_make_testcase(DAY_NINETEEN_HEADER, DAY_NINETEEN_LINE_C);
-test_data DAY_NINETEEN_D = day_19_make_testcase(DAY_NINETEEN_HEADER, DAY_NINETEEN_LINE_D);
-test_data DAY_NINETEEN_E = day_19_make_testcase(DAY_NINETEEN_HEADER, DAY_NINETEEN_LINE_E);
-test_data DAY_NINETEEN_F = day_19_make_testcase(DAY_NINETEEN_HEADER, DAY_NINETEEN_LINE_F);
-test_data DAY_NINETEEN_G = day_19_make_testcase(DAY_NINETEEN_HEADER, DAY_NINETEEN_LINE_G);
-test_data DAY_NINETEEN_H = day_19_make_testcase(DAY_NINETEEN_HEADER, DAY_NINETEEN_LINE_H);
-test_data DAY_NINETEEN_I = day_19_make_testcase(DAY_NINETEEN_HEADER,
+constexpr test_data DAY_NINETEEN_LINE_A = "brwrr";
+constexpr test_data DAY_NINETEEN_LINE_B = "bggr";
+constexpr test_data DAY_NINETEEN_LINE_C = "gbbr";
+constexpr test_data DAY_NINETEEN_LINE_D = "rrbgbr";
+constexpr test_data DAY_NINETEEN_LINE_E = "ubwu";
+constexpr test_data DAY_NINETEEN_LINE_F = "bwurrg";
+constexpr test_data DAY_NINETEEN_LINE_G = "brgr";
+constexpr test_data DAY_NINETEEN_LINE_H = "bbrgwb";
+
+constexpr test_data DAY_NINETEEN_A = day_19_make_testcase(DAY_NINETEEN_HEADER, DAY_NINETEEN_LINE_A);
+constexpr test_data DAY_NINETEEN_B = day_19_make_testcase(DAY_NINETEEN_HEADER, DAY_NINETEEN_LINE_B);
+constexpr test_data DAY_NINETEEN_C = day_19_make_testcase(DAY_NINETEEN_HEADER, DAY_NINETEEN_LINE_C);
+constexpr test_data DAY_NINETEEN_D = day_19_make_testcase(DAY_NINETEEN_HEADER, DAY_NINETEEN_LINE_D);
+constexpr test_data DAY_NINETEEN_E = day_19_make_testcase(DAY_NINETEEN_HEADER, DAY_NINETEEN_LINE_E);
+constexpr test_data DAY_NINETEEN_F = day_19_make_testcase(DAY_NINETEEN_HEADER, DAY_NINETEEN_LINE_F);
+constexpr test_data DAY_NINETEEN_G = day_19_make_testcase(DAY_NINETEEN_HEADER, DAY_NINETEEN_LINE_G);
+constexpr test_data DAY_NINETEEN_H = day_19_make_testcase(DAY_NINETEEN_HEADER, DAY_NINETEEN_LINE_H);
+constexpr test_data DAY_NINETEEN_I = day_19_make_testcase(DAY_NINETEEN_HEADER,
 	DAY_NINETEEN_LINE_A,
 	DAY_NINETEEN_LINE_B,
 	DAY_NINETEEN_LINE_C,
@@ -493,7 +495,7 @@ test_data DAY_NINETEEN_I = day_19_make_testcase(DAY_NINETEEN_HEADER,
 	DAY_NINETEEN_LINE_G,
 	DAY_NINETEEN_LINE_H);
 
-test_data DAY_TWENTY_A =
+constexpr test_data DAY_TWENTY_A =
 R"(###############
 #...#...#.....#
 #.#.#.#.#.###.#
@@ -510,16 +512,16 @@ R"(###############
 #...#...#...###
 ###############)";
 
-test_data DAY_TWENTYTWO_A = "123";
-test_data DAY_TWENTYTWO_B = "1";
-test_data DAY_TWENTYTWO_C = "10";
-test_data DAY_TWENTYTWO_D = "100";
-test_data DAY_TWENTYTWO_E = "2024";
-test_data DAY_TWENTYTWO_F = advent::combine_inputs<1>(DAY_TWENTYTWO_B, DAY_TWENTYTWO_C, DAY_TWENTYTWO_D, DAY_TWENTYTWO_E);
+constexpr test_data DAY_TWENTYTWO_A = "123";
+constexpr test_data DAY_TWENTYTWO_B = "1";
+constexpr test_data DAY_TWENTYTWO_C = "10";
+constexpr test_data DAY_TWENTYTWO_D = "100";
+constexpr test_data DAY_TWENTYTWO_E = "2024";
+constexpr test_data DAY_TWENTYTWO_F = advent::combine_inputs<1>(DAY_TWENTYTWO_B, DAY_TWENTYTWO_C, DAY_TWENTYTWO_D, DAY_TWENTYTWO_E);
 
-test_data DAY_TWENTYTWO_G = "1\n2\n3\n2024";
+constexpr test_data DAY_TWENTYTWO_G = "1\n2\n3\n2024";
 
-test_data DAY_TWENTYTHREE_A =
+constexpr test_data DAY_TWENTYTHREE_A =
 R"(kh-tc
 qp-kh
 de-cg
@@ -553,7 +555,7 @@ wh-qp
 tb-vc
 td-yn)";
 
-test_data DAY_TWENTYFOUR_A =
+constexpr test_data DAY_TWENTYFOUR_A =
 R"(x00: 1
 x01: 1
 x02: 1
@@ -565,7 +567,7 @@ x00 AND y00 -> z00
 x01 XOR y01 -> z01
 x02 OR y02 -> z02)";
 
-test_data DAY_TWENTYFOUR_B =
+constexpr test_data DAY_TWENTYFOUR_B =
 R"(x00: 1
 x01: 0
 x02: 1
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <chrono>
+#include <optional>
+#include <cstdint>
+
+// Result a test can give.
+enum class test_status : char
+{
+	pass,
+	fail,
+	unknown,
+	filtered,
+	timeout
+};
+
+std::string_view to_string(test_status status);
+
+// Timing statistics from running a test repeatedly in benchmark mode.
+struct benchmark_stats
+{
+	std::size_t num_samples = 0u;
+	std::chrono::nanoseconds min{};
+	std::chrono::nanoseconds median{};
+	std::chrono::nanoseconds mean{};
+	std::chrono::nanoseconds p90{};
+	std::chrono::nanoseconds p99{};
+	std::chrono::nanoseconds stddev{};
+};
+
+// A named measurement taken while running a test, e.g. an allocation count.
+struct test_counter
+{
+	std::string name;
+	int64_t value = 0;
+};
+
+// Full results of a test.
+struct test_result
+{
+	std::string name;
+	std::string result;
+	std::string expected;
+	test_status status = test_status::unknown;
+	std::chrono::nanoseconds time_taken{};
+	std::optional<benchmark_stats> benchmark;
+	std::vector<test_counter> counters;
+
+	// The time to compare between runs: the median in benchmark mode, otherwise the single run time.
+	std::chrono::nanoseconds representative_time() const { return benchmark.has_value() ? benchmark->median : time_taken; }
+};
\ No newline at end of file
@@ -1,46 +1,33 @@
 #pragma once
 
-#include <functional>
 #include <string>
 #include <string_view>
 #include <optional>
 #include <variant>
+#include <cstdint>
+#include <iosfwd>
 
 #include "advent/advent_types.h"
 
-using TestFunc = std::function<ResultType()>;
-using TestFuncWithArg = std::function<ResultType(std::istream&)>;
+using TestFunc = ResultType(*)();
+using TestFuncWithArg = ResultType(*)(std::istream&);
 
-struct TestExecutable
-{
-	TestFunc func;
-	ResultType execute() { return func(); }
-	explicit TestExecutable(TestFunc func_) : func{func_}{}
-};
-
-struct TestWithArgExecutable
-{
-	TestFuncWithArg func;
-	std::string arg;
-	ResultType execute();
-	TestWithArgExecutable(TestFuncWithArg func_, std::string arg_) : func(func_) , arg(std::move(arg_)){}
-};
+// The result a test should give, exactly as written in the table of tests. std::monostate means it is not known yet.
+using ExpectedResult = std::variant<std::monostate, int64_t, std::string_view>;
 
-using Test = std::variant<TestExecutable,TestWithArgExecutable>;
-
-// This describes a test to run.
+// This describes a test to run. It only holds function pointers and views of string literals and constexpr
+// test inputs, so a whole table of them can be built at compile time.
 struct verification_test
 {
-	std::string name;
-	Test test_func;
-	std::optional<std::string> expected_result;
-	verification_test(std::string name_, TestFunc func) : verification_test{ std::move(name_), func, std::nullopt }{}
-	verification_test(std::string name_, TestFunc func, std::string result) : verification_test{std::move(name_), func, std::optional<std::string>{std::move(result)} }{}
-	verification_test(std::string name_, TestFuncWithArg func, std::string arg) : verification_test{ std::move(name_), func, std::move(arg), std::nullopt } {}
-	verification_test(std::string name_, TestFuncWithArg func, std::string arg, std::string result) : verification_test{ std::move(name_), func, std::move(arg), std::optional<std::string>{std::move(result)} } {}
-private:
-	verification_test(std::string n, TestFunc t, std::optional<std::string> r) : name(std::move(n)),test_func(TestExecutable{t}),expected_result(std::move(r)){} 
-	verification_test(std::string n, TestFuncWithArg t, std::string arg, std::optional<std::string> r) : name(std::move(n)),test_func(TestWithArgExecutable{t , std::move(arg)}),expected_result(std::move(r)){} 
+	std::string_view name;
+	TestFunc func = nullptr;
+	TestFuncWithArg func_with_arg = nullptr;
+	std::string_view arg;
+	ExpectedResult expected_result;
+
+	// Tests with an argument get a stream reading straight from the view, without copying it.
+	ResultType execute() const;
+	std::optional<std::string> get_expected_result() const;
 };
 
 // A type to use to indicate the result is not known yet. Using this in a verification test
@@ -48,16 +35,38 @@ private:
 struct Dummy {};
 static constexpr Dummy dummy;
 
-verification_test make_test(std::string name, TestFunc func, int64_t result);
-verification_test make_test(std::string name, TestFunc func, std::string result);
-verification_test make_test(std::string name, TestFunc func, Dummy);
+constexpr verification_test make_test(std::string_view name, TestFunc func, int64_t result)
+{
+	return verification_test{ name, func, nullptr, std::string_view{}, ExpectedResult{ result } };
+}
 
-verification_test make_test(std::string name, TestFuncWithArg func, int64_t result, std::string arg);
-verification_test make_test(std::string name, TestFuncWithArg func, std::string result, std::string arg);
-verification_test make_test(std::string name, TestFuncWithArg func, Dummy, std::string arg);
+constexpr verification_test make_test(std::string_view name, TestFunc func, std::string_view result)
+{
+	return verification_test{ name, func, nullptr, std::string_view{}, ExpectedResult{ result } };
+}
+
+constexpr verification_test make_test(std::string_view name, TestFunc func, Dummy)
+{
+	return verification_test{ name, func, nullptr, std::string_view{}, ExpectedResult{} };
+}
+
+constexpr verification_test make_test(std::string_view name, TestFuncWithArg func, int64_t result, std::string_view arg)
+{
+	return verification_test{ name, nullptr, func, arg, ExpectedResult{ result } };
+}
+
+constexpr verification_test make_test(std::string_view name, TestFuncWithArg func, std::string_view result, std::string_view arg)
+{
+	return verification_test{ name, nullptr, func, arg, ExpectedResult{ result } };
+}
+
+constexpr verification_test make_test(std::string_view name, TestFuncWithArg func, Dummy, std::string_view arg)
+{
+	return verification_test{ name, nullptr, func, arg, ExpectedResult{} };
+}
 
-#define ARG(func_name) std::string{ #func_name },func_name
-#define ARG_WITH_PARAM(func_name,param) std::string{ #func_name "("  #param ")"  }, func_name
+#define ARG(func_name) std::string_view{ #func_name },func_name
+#define ARG_WITH_PARAM(func_name,param) std::string_view{ #func_name "("  #param ")"  }, func_name
 #define TESTCASE(func_name,expected_result) make_test(ARG(func_name),expected_result)
 #define TESTCASE_WITH_ARG(func_name,arg,expected_result) make_test(ARG_WITH_PARAM(func_name,arg),expected_result,arg)
 #define FUNC_NAME(day_num,part_num) advent_ ## day_num ## _p ## part_num
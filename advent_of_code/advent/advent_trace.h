@@ -0,0 +1,63 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+// Lightweight scoped tracing. Put ADVENT_TRACE_SCOPE("name") at the top of a block and, while tracing is
+// enabled, the time spent in that block is recorded on the current thread. The events can be written out as
+// Chrome trace-event JSON, which chrome://tracing and Perfetto show as a timeline.
+//
+// When tracing is disabled a scope costs one relaxed atomic load. Names must be string literals (or otherwise
+// outlive the program) because only the pointer is stored.
+#define ADVENT_TRACE_CONCAT_IMPL(a,b) a ## b
+#define ADVENT_TRACE_CONCAT(a,b) ADVENT_TRACE_CONCAT_IMPL(a,b)
+#define ADVENT_TRACE_SCOPE(name) const advent::trace::scope ADVENT_TRACE_CONCAT(advent_trace_scope_,__LINE__){ name }
+
+namespace advent::trace
+{
+	namespace internal
+	{
+		inline std::atomic_bool& enabled_flag()
+		{
+			static std::atomic_bool enabled{ false };
+			return enabled;
+		}
+
+		int64_t get_timestamp();
+		void record_event(const char* name, int64_t start_time, int64_t end_time);
+	}
+
+	inline bool is_enabled()
+	{
+		return internal::enabled_flag().load(std::memory_order_relaxed);
+	}
+
+	void set_enabled(bool enabled);
+
+	// Enable tracing and write every recorded event to output_path when the program exits.
+	void write_at_exit(std::string output_path);
+
+	// Write every event recorded so far. Threads which are still recording may not have all their events included.
+	void write_chrome_trace(std::ostream& output);
+
+	class scope
+	{
+		const char* m_name;
+		int64_t m_start_time;
+	public:
+		explicit scope(const char* name) noexcept
+			: m_name{ is_enabled() ? name : nullptr }, m_start_time{ m_name != nullptr ? internal::get_timestamp() : 0 } {}
+		~scope()
+		{
+			if (m_name != nullptr)
+			{
+				internal::record_event(m_name, m_start_time, internal::get_timestamp());
+			}
+		}
+		scope(const scope&) = delete;
+		scope& operator=(const scope&) = delete;
+	};
+}
\ No newline at end of file
@@ -5,6 +5,12 @@
 #include <iostream>
 #include <filesystem>
 #include <format>
+#include <spanstream>
+#include <memory>
+#include <mutex>
+#include <map>
+#include <typeindex>
+#include <atomic>
 
 #include "advent_assert.h"
 
@@ -24,11 +30,108 @@ namespace advent
 		return result;
 	}
 
+	namespace input_cache_internal
+	{
+		inline std::atomic_bool& caching_enabled()
+		{
+			static std::atomic_bool enabled{ true };
+			return enabled;
+		}
+
+		struct cached_model
+		{
+			std::once_flag once;
+			std::shared_ptr<const void> model;
+		};
+
+		inline std::shared_ptr<cached_model> get_model_slot(int day, std::type_index model_type)
+		{
+			using Key = std::pair<int, std::type_index>;
+			static std::mutex cache_mutex;
+			static std::map<Key, std::shared_ptr<cached_model>> cache;
+			std::scoped_lock lock{ cache_mutex };
+			auto& slot = cache[Key{ day, model_type }];
+			if (!slot)
+			{
+				slot = std::make_shared<cached_model>();
+			}
+			return slot;
+		}
+	}
+
+	// Puzzle inputs and parsed models are cached by default. Turn this off to make every call read and parse
+	// from scratch, e.g. to benchmark the full cost of a solution.
+	inline void set_input_caching_enabled(bool enabled)
+	{
+		input_cache_internal::caching_enabled() = enabled;
+	}
+
+	inline bool is_input_caching_enabled()
+	{
+		return input_cache_internal::caching_enabled();
+	}
+
+	// Returns the whole contents of the file. Each file is only read once: after that the same immutable buffer is
+	// shared between every caller. Safe to call from multiple threads.
+	inline std::shared_ptr<const std::string> get_cached_file(const std::string& filename)
+	{
+		auto read_file = [&filename]()
+			{
+				std::ifstream input = open_input(filename);
+				return std::make_shared<const std::string>(std::istreambuf_iterator<char>{input}, std::istreambuf_iterator<char>{});
+			};
+
+		if (!is_input_caching_enabled())
+		{
+			return read_file();
+		}
+
+		static std::mutex cache_mutex;
+		static std::map<std::string, std::shared_ptr<const std::string>, std::less<>> cache;
+		std::scoped_lock lock{ cache_mutex };
+		auto cache_it = cache.find(filename);
+		if (cache_it == end(cache))
+		{
+			cache_it = cache.insert(std::pair{ filename, read_file() }).first;
+		}
+		return cache_it->second;
+	}
+
+	// A stream reading from a cached file. Keeps the buffer alive for as long as the stream exists.
+	class cached_input_stream : public std::ispanstream
+	{
+		std::shared_ptr<const std::string> m_buffer;
+		explicit cached_input_stream(std::shared_ptr<const std::string> buffer, std::span<const char> view)
+			: std::ispanstream{ view }, m_buffer{ std::move(buffer) } {}
+	public:
+		explicit cached_input_stream(std::shared_ptr<const std::string> buffer)
+			: cached_input_stream{ buffer, std::span<const char>{ buffer->data(), buffer->size() } } {}
+		cached_input_stream(cached_input_stream&&) = default;
+		cached_input_stream& operator=(cached_input_stream&&) = default;
+		std::string_view view() const noexcept { return *m_buffer; }
+	};
+
+	// A stream over a buffer owned by someone else, such as an advent::mapped_input. The buffer is not copied,
+	// so it must outlive the stream.
+	inline std::ispanstream open_view_stream(std::string_view input)
+	{
+		return std::ispanstream{ std::span<const char>{ input.data(), input.size() } };
+	}
+
+	inline cached_input_stream open_cached_input(const std::string& filename)
+	{
+		return cached_input_stream{ get_cached_file(filename) };
+	}
+
+	inline std::string get_puzzle_input_name(int day)
+	{
+		return std::format("advent{0}/advent{0}.txt", day);
+	}
+
 	// Opens a file with the name "adventX/adventX.txt"
-	inline std::ifstream open_puzzle_input(int day)
+	inline cached_input_stream open_puzzle_input(int day)
 	{
-		const std::string name = std::format("advent{0}/advent{0}.txt", day);
-		return open_input(name);
+		return open_cached_input(get_puzzle_input_name(day));
 	}
 
 	// Open a file with the format "adventX/testcase_Y.txt"
@@ -37,4 +140,27 @@ namespace advent
 		const std::string name = std::format("advent{0}/testcase_{1}.txt", day, id);
 		return open_input(name);
 	}
+
+	// Opt-in cache for whatever a day builds from its puzzle input, so part two can reuse the model part one parsed.
+	// parse_fn is called with a std::istream& over the puzzle input and must return a ModelType. It is called at most
+	// once per day and model type, and the result is shared between both parts and any other threads.
+	template <typename ModelType, typename ParseFn>
+	inline std::shared_ptr<const ModelType> get_cached_puzzle_model(int day, const ParseFn& parse_fn)
+	{
+		auto parse = [day, &parse_fn]()
+			{
+				auto input = open_puzzle_input(day);
+				return std::make_shared<const ModelType>(parse_fn(input));
+			};
+
+		if (!is_input_caching_enabled())
+		{
+			return parse();
+		}
+
+		// Parse outside the cache lock, so different days can parse at the same time.
+		const auto entry = input_cache_internal::get_model_slot(day, std::type_index{ typeid(ModelType) });
+		std::call_once(entry->once, [&entry, &parse]() { entry->model = parse(); });
+		return std::static_pointer_cast<const ModelType>(entry->model);
+	}
 }
\ No newline at end of file
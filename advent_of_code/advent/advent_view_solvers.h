@@ -0,0 +1,14 @@
+#pragma once
+
+#include <string_view>
+
+#include "advent/advent_types.h"
+
+// Every day's solution, taking the whole puzzle input as a view. Useful for running a day on an arbitrary input.
+namespace advent
+{
+	using view_solver_func = ResultType(*)(std::string_view);
+
+	// Returns nullptr if there is no such day or part.
+	view_solver_func get_view_solver(int day, int part);
+}
\ No newline at end of file
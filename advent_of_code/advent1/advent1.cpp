@@ -26,6 +26,7 @@ namespace
 }
 
 #include <numeric>
+#include <charconv>
 namespace
 {
 	using ValT = int;
@@ -51,9 +52,42 @@ namespace
 		return result;
 	}
 
-	int64_t solve_p1(std::istream& input)
+	std::pair<ValList, ValList> read_vals(std::string_view input)
 	{
-		auto [left,right] = read_vals(input);
+		// Every line has two numbers, three spaces and a newline.
+		const std::size_t reserve_amount = input.size() / 6u;
+		std::pair<ValList, ValList> result;
+		result.first.reserve(reserve_amount);
+		result.second.reserve(reserve_amount);
+
+		auto skip_whitespace = [&input]()
+			{
+				input.remove_prefix(std::min(input.find_first_not_of(" \t\r\n"), input.size()));
+			};
+		auto read_val = [&input]()
+			{
+				ValT val{};
+				const auto [end_ptr, error] = std::from_chars(input.data(), input.data() + input.size(), val);
+				AdventCheckMsg(error == std::errc{}, "Could not read number at:", input.substr(0, 16));
+				input.remove_prefix(end_ptr - input.data());
+				return val;
+			};
+
+		skip_whitespace();
+		while (!input.empty())
+		{
+			result.first.push_back(read_val());
+			skip_whitespace();
+			result.second.push_back(read_val());
+			skip_whitespace();
+		}
+		AdventCheck(result.first.size() == result.second.size());
+		return result;
+	}
+
+	int64_t solve_p1(std::pair<ValList, ValList> vals)
+	{
+		auto& [left, right] = vals;
 		auto reduce_op = std::plus<ValT>{};
 		auto trans_op = [](ValT l, ValT s) { return std::abs(l - s); };
 
@@ -68,13 +102,23 @@ namespace
 			trans_op);
 		return result;
 	}
+
+	int64_t solve_p1(std::istream& input)
+	{
+		return solve_p1(read_vals(input));
+	}
+
+	int64_t solve_p1(std::string_view input)
+	{
+		return solve_p1(read_vals(input));
+	}
 }
 
 namespace
 {
-	int64_t solve_p2(std::istream& input)
+	int64_t solve_p2(std::pair<ValList, ValList> vals)
 	{
-		auto [left, right] = read_vals(input);
+		auto& [left, right] = vals;
 		stdr::sort(right);
 
 		auto reduce_op = std::plus<ValT>{};
@@ -92,6 +136,16 @@ namespace
 			transform_op);
 		return result;
 	}
+
+	int64_t solve_p2(std::istream& input)
+	{
+		return solve_p2(read_vals(input));
+	}
+
+	int64_t solve_p2(std::string_view input)
+	{
+		return solve_p2(read_vals(input));
+	}
 }
 
 ResultType day_one_p1_a(std::istream& input)
@@ -107,12 +161,22 @@ ResultType day_one_p2_a(std::istream& input)
 ResultType advent_one_p1()
 {
 	auto input = advent::open_puzzle_input(1);
-	return solve_p1(input);
+	return solve_p1(input.view());
 }
 
 ResultType advent_one_p2()
 {
 	auto input = advent::open_puzzle_input(1);
+	return solve_p2(input.view());
+}
+
+ResultType advent_1::p1(std::string_view input)
+{
+	return solve_p1(input);
+}
+
+ResultType advent_1::p2(std::string_view input)
+{
 	return solve_p2(input);
 }
 
@@ -2,8 +2,16 @@
 
 #include "advent/advent_types.h"
 
+#include <string_view>
+
 ResultType day_one_p1_a(std::istream& input);
 ResultType day_one_p2_a(std::istream& input);
 
+namespace advent_1
+{
+	ResultType p1(std::string_view input);
+	ResultType p2(std::string_view input);
+}
+
 ResultType advent_one_p1();
 ResultType advent_one_p2();
@@ -151,5 +151,17 @@ ResultType advent_ten_p2()
 	return solve_p2(input);
 }
 
+ResultType advent_10::p1(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p1(stream);
+}
+
+ResultType advent_10::p2(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p2(stream);
+}
+
 #undef DAY10DBG
 #undef ENABLE_DAY10DBG
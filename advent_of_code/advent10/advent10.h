@@ -2,8 +2,16 @@
 
 #include "advent/advent_types.h"
 
+#include <string_view>
+
 ResultType day_ten_p1_a(std::istream&);
 ResultType day_ten_p2_a(std::istream&);
 
+namespace advent_10
+{
+	ResultType p1(std::string_view input);
+	ResultType p2(std::string_view input);
+}
+
 ResultType advent_ten_p1();
 ResultType advent_ten_p2();
@@ -32,6 +32,7 @@ namespace
 #include "int_range.h"
 
 #include <map>
+#include <shared_mutex>
 
 namespace
 {
@@ -76,32 +77,55 @@ namespace
 		return { 2024u * in };
 	}
 
+	// Results kept between calls, shared by every thread. Only ever holds complete fill_memo results: every blink
+	// count from 1 up for each stone it has.
+	struct SharedMemo
+	{
+		std::shared_mutex mutex;
+		Memo memo;
+	};
+
+	// Vector is FURTHEST to NEAREST steps
+	std::vector<std::size_t> read_memo(const Memo& memo, Stone stone, int num_blinks)
+	{
+		std::vector<std::size_t> result;
+		result.reserve(num_blinks);
+		utils::int_range blink_range{ num_blinks,0,-1 };
+		std::transform(begin(blink_range), end(blink_range), std::back_inserter(result),
+			[&memo, stone](int blinks)
+			{
+				auto entry = memo.find({ stone,blinks });
+				AdventCheck(entry != end(memo));
+				return entry->second;
+			});
+		return result;
+	}
+
 	// Vector is FURTHEST to NEAREST steps
-	std::vector<std::size_t> fill_memo(Memo& memo, Stone stone, int num_blinks)
+	std::vector<std::size_t> fill_memo(Memo& memo, SharedMemo* shared, Stone stone, int num_blinks)
 	{
 		AdventCheck(num_blinks >= 0);
 		std::vector<std::size_t> result;
 		if (num_blinks == 0) return result;
 		if (memo.contains({ stone,num_blinks }))
 		{
-			result.reserve(num_blinks);
-			utils::int_range blink_range{ num_blinks,0,-1 };
-			std::transform(begin(blink_range), end(blink_range), std::back_inserter(result),
-				[&memo, stone](int blinks)
-				{
-					auto entry = memo.find({ stone,blinks });
-					AdventCheck(entry != end(memo));
-					return entry->second;
-				});
-			return result;
+			return read_memo(memo, stone, num_blinks);
+		}
+		if (shared != nullptr)
+		{
+			std::shared_lock lock{ shared->mutex };
+			if (shared->memo.contains({ stone,num_blinks }))
+			{
+				return read_memo(shared->memo, stone, num_blinks);
+			}
 		}
 
 		const utils::small_vector<Stone, 2> step = apply_blink(stone);
 		AdventCheck(!step.empty());
-		result = fill_memo(memo, step.front(), num_blinks - 1);
+		result = fill_memo(memo, shared, step.front(), num_blinks - 1);
 		for (Stone s : stdv::drop(step, 1))
 		{
-			const std::vector<std::size_t> subresults = fill_memo(memo, s, num_blinks - 1);
+			const std::vector<std::size_t> subresults = fill_memo(memo, shared, s, num_blinks - 1);
 			AdventCheck(subresults.size() == result.size());
 			std::transform(begin(result), end(result), begin(subresults), begin(result), std::plus<std::size_t>{});
 		}
@@ -117,7 +141,7 @@ namespace
 		return result;
 	}
 
-	std::size_t advance_stone(Memo& memo, Stone stone, int num_blinks)
+	std::size_t advance_stone(Memo& memo, SharedMemo* shared, Stone stone, int num_blinks)
 	{
 		AdventCheck(num_blinks > 0);
 		const auto entry = memo.find({ stone,num_blinks });
@@ -126,7 +150,7 @@ namespace
 			return entry->second;
 		}
 
-		const auto all_results = fill_memo(memo, stone, num_blinks);
+		const auto all_results = fill_memo(memo, shared, stone, num_blinks);
 		AdventCheck(std::ssize(all_results) == num_blinks);
 		return all_results.front();
 	}
@@ -137,7 +161,7 @@ namespace
 		const std::size_t result = std::transform_reduce(begin(input), end(input), std::size_t{ 0u }, std::plus<std::size_t>{},
 			[&memo, num_blinks](Stone s)
 			{
-				return advance_stone(memo, s, num_blinks);
+				return advance_stone(memo, nullptr, s, num_blinks);
 			});
 		return result;
 	}
@@ -146,6 +170,39 @@ namespace
 	{
 		return solve_generic(parse_input(input), num_blinks);
 	}
+
+	// The memo doesn't depend on the input, so a long-lived process (e.g. server mode) can keep it between calls.
+	// Each call works in a memo of its own, and checks the shared one under a shared lock for any stone it hasn't
+	// seen yet, at any depth of the recursion. So a call reuses the work of earlier ones on every stone they had in
+	// common, not just on identical input stones. The exclusive lock is only taken to hand the results back, so calls
+	// on different threads don't wait on each other's solves. Results stop being kept once the shared memo is big
+	// enough, so it can't grow for ever.
+	std::size_t solve_with_shared_memo(std::string_view input, int num_blinks)
+	{
+		constexpr std::size_t max_shared_memo_size = 1u << 20;
+		static SharedMemo shared_memo;
+
+		auto stream = advent::open_view_stream(input);
+		const utils::small_vector<Stone, 8> stones = parse_input(stream);
+
+		Memo memo;
+		const std::size_t result = std::transform_reduce(begin(stones), end(stones), std::size_t{ 0u }, std::plus<std::size_t>{},
+			[&memo, num_blinks](Stone s)
+			{
+				return advance_stone(memo, &shared_memo, s, num_blinks);
+			});
+
+		if (!memo.empty())
+		{
+			std::unique_lock lock{ shared_memo.mutex };
+			// All or nothing, so the shared memo only ever holds complete results.
+			if (shared_memo.memo.size() + memo.size() <= max_shared_memo_size)
+			{
+				shared_memo.memo.merge(memo);
+			}
+		}
+		return result;
+	}
 }
 
 ResultType day_eleven::p1_a(std::istream& input, int num_blinks)
@@ -165,5 +222,15 @@ ResultType advent_eleven_p2()
 	return solve_generic(input, 75);
 }
 
+ResultType advent_11::p1(std::string_view input)
+{
+	return solve_with_shared_memo(input, 25);
+}
+
+ResultType advent_11::p2(std::string_view input)
+{
+	return solve_with_shared_memo(input, 75);
+}
+
 #undef DAY11DBG
 #undef ENABLE_DAY11DBG
@@ -2,6 +2,8 @@
 
 #include "advent/advent_types.h"
 
+#include <string_view>
+
 namespace day_eleven
 {
 	ResultType p1_a(std::istream& input, int num_blinks);
@@ -13,5 +15,11 @@ inline ResultType day_eleven_p1_a(std::istream& input)
 	return day_eleven::p1_a(input, NumBlinks);
 }
 
+namespace advent_11
+{
+	ResultType p1(std::string_view input);
+	ResultType p2(std::string_view input);
+}
+
 ResultType advent_eleven_p1();
 ResultType advent_eleven_p2();
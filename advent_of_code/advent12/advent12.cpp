@@ -191,5 +191,17 @@ ResultType advent_twelve_p2()
 	return solve_generic<AdventDay::two>(input);
 }
 
+ResultType advent_12::p1(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_generic<AdventDay::one>(stream);
+}
+
+ResultType advent_12::p2(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_generic<AdventDay::two>(stream);
+}
+
 #undef DAY12DBG
 #undef ENABLE_DAY12DBG
@@ -192,5 +192,17 @@ ResultType advent_thirteen_p2()
 	return solve_p2(input);
 }
 
+ResultType advent_13::p1(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p1(stream);
+}
+
+ResultType advent_13::p2(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p2(stream);
+}
+
 #undef DAY13DBG
 #undef ENABLE_DAY13DBG
@@ -2,7 +2,15 @@
 
 #include "advent/advent_types.h"
 
+#include <string_view>
+
 ResultType day_thirteen_p1_a(std::istream&);
 
+namespace advent_13
+{
+	ResultType p1(std::string_view input);
+	ResultType p2(std::string_view input);
+}
+
 ResultType advent_thirteen_p1();
 ResultType advent_thirteen_p2();
@@ -408,5 +408,17 @@ ResultType advent_fourteen_p2()
 	return solve_p2(input);
 }
 
+ResultType advent_14::p1(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p1(stream,101,103);
+}
+
+ResultType advent_14::p2(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p2(stream);
+}
+
 #undef DAY14DBG
 #undef ENABLE_DAY14DBG
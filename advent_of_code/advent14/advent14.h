@@ -2,6 +2,8 @@
 
 #include "advent/advent_types.h"
 
+#include <string_view>
+
 namespace day_fourteen_internal
 {
 	ResultType p1_a(int num_steps);
@@ -16,5 +18,11 @@ ResultType day_fourteen_p1_a()
 
 ResultType day_fourteen_p1_b();
 
+namespace advent_14
+{
+	ResultType p1(std::string_view input);
+	ResultType p2(std::string_view input);
+}
+
 ResultType advent_fourteen_p1();
 ResultType advent_fourteen_p2();
@@ -466,5 +466,17 @@ ResultType advent_fifteen_p2()
 	return solve_p2(input);
 }
 
+ResultType advent_15::p1(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p1(stream);
+}
+
+ResultType advent_15::p2(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p2(stream);
+}
+
 #undef DAY15DBG
 #undef ENABLE_DAY15DBG
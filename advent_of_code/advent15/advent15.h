@@ -2,9 +2,17 @@
 
 #include "advent/advent_types.h"
 
+#include <string_view>
+
 ResultType day_fifteen_p1_a(std::istream&);
 ResultType day_fifteen_p2_a(std::istream&);
 
 
+namespace advent_15
+{
+	ResultType p1(std::string_view input);
+	ResultType p2(std::string_view input);
+}
+
 ResultType advent_fifteen_p1();
 ResultType advent_fifteen_p2();
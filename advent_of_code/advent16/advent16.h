@@ -2,8 +2,16 @@
 
 #include "advent/advent_types.h"
 
+#include <string_view>
+
 ResultType day_sixteen_p1_a(std::istream&);
 ResultType day_sixteen_p2_a(std::istream&);
 
+namespace advent_16
+{
+	ResultType p1(std::string_view input);
+	ResultType p2(std::string_view input);
+}
+
 ResultType advent_sixteen_p1();
 ResultType advent_sixteen_p2();
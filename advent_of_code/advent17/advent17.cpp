@@ -234,5 +234,17 @@ ResultType advent_seventeen_p2()
 	return solve_p2(input);
 }
 
+ResultType advent_17::p1(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p1(stream);
+}
+
+ResultType advent_17::p2(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p2(stream);
+}
+
 #undef DAY17DBG
 #undef ENABLE_DAY17DBG
@@ -2,10 +2,18 @@
 
 #include "advent/advent_types.h"
 
+#include <string_view>
+
 ResultType day_seventeen_p1(std::istream&);
 ResultType day_seventeen_p1_a(std::istream&);
 ResultType day_seventeen_p1_b(std::istream&);
 ResultType day_seventeen_p1_c(std::istream&);
 
+namespace advent_17
+{
+	ResultType p1(std::string_view input);
+	ResultType p2(std::string_view input);
+}
+
 ResultType advent_seventeen_p1();
 ResultType advent_seventeen_p2();
@@ -18,9 +18,12 @@
 
 #include "coords.h"
 #include "istream_line_iterator.h"
+#include "string_line_iterator.h"
 #include "range_contains.h"
 #include "sorted_vector.h"
-#include "binary_find.h"
+#include "small_vector.h"
+#include "jump_point_search.h"
+#include "grid_connectivity.h"
 #include "parse_utils.h"
 #include "coords_iterators.h"
 
@@ -49,7 +52,10 @@ namespace
 	CoordList get_corrupted_locations(std::istream& input, int num_bytes, const Coords& limit)
 	{
 		CoordList coords;
-		coords.reserve(num_bytes);
+		if (num_bytes < std::numeric_limits<int>::max())
+		{
+			coords.reserve(num_bytes);
+		}
 		utils::istream_line_range input_range{ input };
 		stdr::transform(input_range | stdv::take(num_bytes), std::back_inserter(coords), Coords::from_chars);
 
@@ -63,107 +69,47 @@ namespace
 	int pathfind_out(const utils::sorted_vector<Coords>& corrupted, const Coords& finish)
 	{
 		constexpr Coords start{ 0,0 };
-		struct Node
-		{
-			Coords location;
-			std::size_t id = 0u;
-			std::size_t prev_id = 0u;
-			int steps = 0;
-			int heuristic = 0;
-		};
-
-		struct HeuristicSort
-		{
-			bool operator()(const Node& l, const Node& r) const { return l.heuristic > r.heuristic; } // HIGHER heuristic scores at front.
-		};
+		if (corrupted.contains(start)) return -1;
 
-		struct IDSort
+		const Coords grid_size = finish + Coords{ 1,1 };
+		const std::size_t width = static_cast<std::size_t>(grid_size.x);
+		std::vector<bool> is_corrupted(width * static_cast<std::size_t>(grid_size.y), false);
+		for (const Coords& c : corrupted)
 		{
-			bool operator()(const Node& l, const Node& r) const { return l.id < r.id; }
-		};
-
-		CoordList result;
-
-		std::size_t last_id = 0u;
+			is_corrupted[static_cast<std::size_t>(c.y) * width + static_cast<std::size_t>(c.x)] = true;
+		}
 
-		auto make_node_base = [&finish, &last_id](const Coords& loc, std::size_t last_node_id, int new_steps)
+		// Every step costs 1 and the grid is mostly open, so jump point search only has to expand a few cells.
+		utils::jump_point_search<false> search{ grid_size };
+		const std::vector<Coords> path = search.find_path(start, finish, [&is_corrupted, width](const Coords& c)
 			{
-				return Node{
-					loc,
-					++last_id,
-					last_node_id,
-					new_steps,
-					new_steps + loc.manhatten_distance(finish)
-				};
-			};
-
-		auto make_node = [&make_node_base](const Coords& loc, const Node& prev)
-			{
-				return make_node_base(loc, prev.id, prev.steps + 1);
-			};
-
-		std::vector<Node> visited_locations;
-		utils::sorted_vector<Node, HeuristicSort> nodes_to_check{ make_node_base(start,0u,0u) };
-
-		while (!nodes_to_check.empty())
-		{
-			const Node node = nodes_to_check.back();
-			nodes_to_check.pop_back();
-
-			if (!validate_coords(node.location, finish)) continue;
-			if (corrupted.contains(node.location)) continue;
-
-			if (stdr::find_if(visited_locations | stdv::reverse, [&loc = node.location](const Node& n) { return n.location == loc; }) != rend(visited_locations)) continue;
+				return is_corrupted[static_cast<std::size_t>(c.y) * width + static_cast<std::size_t>(c.x)];
+			});
+		const int steps = path.empty() ? -1 : static_cast<int>(path.size()) - 1;
 
-			if (node.location == finish)
-			{
 #if DAY18DBG
-				Node node_to_add = node;
-				stdr::sort(visited_locations, IDSort{});
-				result.reserve(node.steps);
-				while (true)
-				{
-					if (node_to_add.prev_id == 0u)
-					{
-						stdr::reverse(result);
-						AdventCheck(result.size() == node.steps);
-						log << "\nPath length " << node.steps << " found:";
-						for (const Coords& c : utils::coords_iterators::get_range(start, finish))
-						{
-							if (c.x == 0) log << '\n';
-							if ((c == start) || (stdr::find(result,c) != end(result)))
-							{
-								log << 'O';
-							}
-							else
-							{
-								log << (corrupted.contains(c) ? '#' : '.');
-							}
-						}
-						break;
-					}
-					result.push_back(node_to_add.location);
-					const auto next_node_it = utils::ranges::binary_find_by_predicate(visited_locations, [id = node_to_add.prev_id](const Node& n) {return n.id <=> id; });
-					AdventCheck(next_node_it != end(visited_locations));
-					node_to_add = *next_node_it;
-				}
-#endif
-				return node.steps;
-			}
-
-			stdr::transform(node.location.neighbours(), std::back_inserter(nodes_to_check), [&node, &make_node](const Coords& loc) {return make_node(loc, node); });
-
-			visited_locations.push_back(node);
+		if (path.empty())
+		{
+			log << "\nNo path found:";
 		}
-#if DAY18DBG
-		log << "\nNo path found:";
-		for (const Coords& c : utils::coords_iterators::get_range(start,finish))
+		else
+		{
+			log << "\nPath length " << steps << " found:";
+		}
+		for (const Coords& c : utils::coords_iterators::get_range(start, finish))
 		{
 			if (c.x == 0) log << '\n';
-			log << (corrupted.contains(c) ? '#' : '.');
+			if (stdr::find(path, c) != end(path))
+			{
+				log << 'O';
+			}
+			else
+			{
+				log << (corrupted.contains(c) ? '#' : '.');
+			}
 		}
 #endif
-		return -1;
+		return steps;
 	}
 
 	int solve_p1(std::istream& input, const Coords& target_location, int num_bytes)
@@ -176,28 +122,15 @@ namespace
 
 namespace
 {
-	CoordList::const_iterator solve_p2(CoordList::const_iterator range_start, CoordList::const_iterator range_end, CoordList::const_iterator search_start, CoordList::const_iterator search_end, const Coords& target_location)
-	{
-		const CoordList::const_iterator midpoint = std::midpoint(search_start, search_end);
-		if (search_start == midpoint)
-		{
-			AdventCheck(search_end != range_end);
-			return search_start;
-		}
-
-		const int path_size = pathfind_out({ range_start, midpoint }, target_location);
-		const bool found_path = (path_size >= 0);
-
-		const CoordList::const_iterator next_start = found_path ? midpoint : search_start;
-		const CoordList::const_iterator next_end = found_path ? search_end : midpoint;
-		return solve_p2(range_start, range_end, next_start, next_end, target_location);
-	}
-
 	std::string solve_p2(std::istream& input, const Coords& target_location)
 	{
-		utils::small_vector<Coords, 1> corrupted_bytes = get_corrupted_locations(input, std::numeric_limits<int>::max(), target_location);
-		const CoordList::const_iterator result_it = solve_p2(begin(corrupted_bytes), end(corrupted_bytes), begin(corrupted_bytes), end(corrupted_bytes), target_location);
-		const Coords& result = *result_it;
+		const CoordList corrupted_bytes = get_corrupted_locations(input, std::numeric_limits<int>::max(), target_location);
+
+		const utils::grid_disconnection disconnection = utils::find_first_disconnecting_insertion(target_location + Coords{ 1,1 },
+			Coords{ 0,0 }, target_location, std::span<const Coords>{ corrupted_bytes.data(), corrupted_bytes.size() });
+		AdventCheckMsg(disconnection.result != utils::grid_disconnection::outcome::never_disconnected, "The exit never gets cut off");
+		AdventCheckMsg(disconnection.result == utils::grid_disconnection::outcome::disconnected_at, "The exit is cut off before any bytes fall");
+		const Coords& result = corrupted_bytes[disconnection.insertion_idx];
 		std::string output = result.to_string();
 		AdventCheck(output.back() == ')');
 		output.pop_back();
@@ -207,6 +140,23 @@ namespace
 	}
 }
 
+namespace
+{
+	// The real puzzle is always a 71x71 memory space, but generated inputs can be bigger.
+	Coords get_memory_limit(std::string_view input)
+	{
+		Coords result{ 70,70 };
+		for (std::string_view line : utils::string_line_range{ input })
+		{
+			if (line.empty()) continue;
+			const Coords byte = Coords::from_chars(line);
+			result.x = std::max(result.x, byte.x);
+			result.y = std::max(result.y, byte.y);
+		}
+		return result;
+	}
+}
+
 ResultType day_eighteen_p1(std::istream& input)
 {
 	return solve_p1(input, Coords{ 6,6 }, 12);
@@ -228,5 +178,17 @@ ResultType advent_eighteen_p2()
 	return solve_p2(input, Coords{ 70,70 });
 }
 
+ResultType advent_18::p1(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p1(stream, get_memory_limit(input), 1024);
+}
+
+ResultType advent_18::p2(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p2(stream, get_memory_limit(input));
+}
+
 #undef DAY18DBG
 #undef ENABLE_DAY18DBG
@@ -2,8 +2,16 @@
 
 #include "advent/advent_types.h"
 
+#include <string_view>
+
 ResultType day_eighteen_p1(std::istream&);
 ResultType day_eighteen_p2(std::istream&);
 
+namespace advent_18
+{
+	ResultType p1(std::string_view input);
+	ResultType p2(std::string_view input);
+}
+
 ResultType advent_eighteen_p1();
 ResultType advent_eighteen_p2();
@@ -34,6 +34,9 @@ namespace
 #include <ranges>
 #include <algorithm>
 #include <execution>
+#include <deque>
+#include <memory>
+#include <mutex>
 
 namespace
 {
@@ -137,11 +140,42 @@ namespace
 		return result;
 	}
 
+	// Parsed and sorted towels, along with the line they point into.
+	struct TowelIndex
+	{
+		std::string towel_line;
+		TowelList towels;
+	};
+
+	// A long-lived process (e.g. server mode) sees the same towels over and over, so keep the most recent
+	// indexes instead of parsing and sorting the towels for every request.
+	std::shared_ptr<const TowelIndex> get_shared_towel_index(std::string towel_line)
+	{
+		constexpr std::size_t max_cached_indexes = 16u;
+		static std::mutex cache_mutex;
+		static std::deque<std::shared_ptr<const TowelIndex>> cache;
+
+		std::scoped_lock lock{ cache_mutex };
+		const auto cache_it = stdr::find(cache, towel_line, [](const auto& index) -> const std::string& { return index->towel_line; });
+		if (cache_it != end(cache))
+		{
+			return *cache_it;
+		}
+
+		auto index = std::make_shared<TowelIndex>();
+		index->towel_line = std::move(towel_line);
+		index->towels = parse_towels<AdventDay::one>(index->towel_line);
+		cache.push_back(index);
+		if (cache.size() > max_cached_indexes)
+		{
+			cache.pop_front();
+		}
+		return index;
+	}
+
 	template <AdventDay day>
-	int64_t solve_generic(std::istream& patterns)
+	int64_t count_patterns(const TowelList& towels, std::istream& patterns)
 	{
-		const std::string towel_line = get_towel_input(patterns);
-		const TowelList towels = parse_towels<day>(towel_line);
 		std::vector<std::string> pattern_list;
 		stdr::transform(utils::istream_line_range{ patterns }, std::back_inserter(pattern_list), [](std::string_view p) {return std::string(p); });
 
@@ -165,6 +199,22 @@ namespace
 		return -1;
 	}
 
+	template <AdventDay day>
+	int64_t solve_generic(std::istream& patterns)
+	{
+		const std::string towel_line = get_towel_input(patterns);
+		const TowelList towels = parse_towels<day>(towel_line);
+		return count_patterns<day>(towels, patterns);
+	}
+
+	template <AdventDay day>
+	int64_t solve_with_shared_index(std::string_view input)
+	{
+		auto stream = advent::open_view_stream(input);
+		const std::shared_ptr<const TowelIndex> index = get_shared_towel_index(get_towel_input(stream));
+		return count_patterns<day>(index->towels, stream);
+	}
+
 	int64_t solve_p1(std::istream& input)
 	{
 		return solve_generic<AdventDay::one>(input);
@@ -198,5 +248,15 @@ ResultType advent_nineteen_p2()
 	return solve_p2(input);
 }
 
+ResultType advent_19::p1(std::string_view input)
+{
+	return solve_with_shared_index<AdventDay::one>(input);
+}
+
+ResultType advent_19::p2(std::string_view input)
+{
+	return solve_with_shared_index<AdventDay::two>(input);
+}
+
 #undef DAY19DBG
 #undef ENABLE_DAY19DBG
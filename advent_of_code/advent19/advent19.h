@@ -2,8 +2,16 @@
 
 #include "advent/advent_types.h"
 
+#include <string_view>
+
 ResultType day_nineteen_p1(std::istream&);
 ResultType day_nineteen_p2(std::istream&);
 
+namespace advent_19
+{
+	ResultType p1(std::string_view input);
+	ResultType p2(std::string_view input);
+}
+
 ResultType advent_nineteen_p1();
 ResultType advent_nineteen_p2();
@@ -152,5 +152,17 @@ ResultType advent_two_p2()
 	return solve_p2(input);
 }
 
+ResultType advent_2::p1(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p1(stream);
+}
+
+ResultType advent_2::p2(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p2(stream);
+}
+
 #undef DAY2DBG
 #undef ENABLE_DAY2DBG
@@ -25,6 +25,8 @@ namespace
 #endif
 }
 
+#include "advent/advent_trace.h"
+
 #include "grid.h"
 
 #include <map>
@@ -87,7 +89,11 @@ namespace
 
 	Grid parse_grid(std::istream& input)
 	{
-		Grid result = utils::grid_helpers::build(input, to_tile);
+		Grid result = [&input]()
+			{
+				ADVENT_TRACE_SCOPE("day20::parse");
+				return utils::grid_helpers::build(input, to_tile);
+			}();
 
 		log << "\nGot grid:";
 		dump_grid(result, DumpGridMode::normal);
@@ -111,6 +117,7 @@ namespace
 #endif
 
 
+		ADVENT_TRACE_SCOPE("day20::cost_grid");
 		utils::small_vector<utils::coords, 1> tiles_to_check = result.get_all_coordinates_by_predicate([](Tile t) {return t.type == TileType::end; });
 		utils::small_vector<utils::coords, 1> next_set_of_tiles;
 		
@@ -168,6 +175,7 @@ namespace
 
 	int64_t count_cheats(const Grid& grid, int threshold, int max_cheat)
 	{
+		ADVENT_TRACE_SCOPE("day20::count_cheats");
 		return stdr::fold_left(
 			utils::coords_iterators::elem_range{ grid.get_max_point() }
 			| stdv::transform([&grid, threshold, max_cheat](utils::coords loc) {return count_cheats_at_location(grid, loc, threshold, max_cheat); }),
@@ -214,5 +222,17 @@ ResultType advent_twenty_p2()
 	return solve_p2(input,100);
 }
 
+ResultType advent_20::p1(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p1(stream, 100);
+}
+
+ResultType advent_20::p2(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p2(stream,100);
+}
+
 #undef DAY20DBG
 #undef ENABLE_DAY20DBG
@@ -2,10 +2,14 @@
 
 #include "advent/advent_types.h"
 
+#include <string_view>
+
 namespace advent_20
 {
 	ResultType p1(std::istream&, int threshold);
 	ResultType p2(std::istream&, int threshold);
+	ResultType p1(std::string_view input);
+	ResultType p2(std::string_view input);
 }
 
 template <int THRESHOLD>
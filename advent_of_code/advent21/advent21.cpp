@@ -53,5 +53,17 @@ ResultType advent_twentyone_p2()
 	return solve_p2(input);
 }
 
+ResultType advent_21::p1(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p1(stream);
+}
+
+ResultType advent_21::p2(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p2(stream);
+}
+
 #undef DAY21DBG
 #undef ENABLE_DAY21DBG
@@ -2,5 +2,13 @@
 
 #include "advent/advent_types.h"
 
+#include <string_view>
+
+namespace advent_21
+{
+	ResultType p1(std::string_view input);
+	ResultType p2(std::string_view input);
+}
+
 ResultType advent_twentyone_p1();
 ResultType advent_twentyone_p2();
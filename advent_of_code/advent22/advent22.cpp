@@ -25,11 +25,16 @@ namespace
 #endif
 }
 
+#include "advent/advent_trace.h"
+
 #include "int_range.h"
 #include "range_contains.h"
 #include "small_vector.h"
 #include "sorted_vector.h"
 #include "comparisons.h"
+#include "string_line_iterator.h"
+#include "to_value.h"
+#include "trim_string.h"
 
 #include <numeric>
 #include <execution>
@@ -68,17 +73,37 @@ namespace
 
 	std::vector<Secret> get_all_initial_secrets(std::istream& input)
 	{
+		ADVENT_TRACE_SCOPE("day22::parse");
 		std::vector<Secret> secrets;
 		secrets.reserve(2000);
 		stdr::copy(stdr::istream_view<Secret>{input}, std::back_inserter(secrets));
 		return secrets;
 	}
 
+	std::vector<Secret> get_all_initial_secrets(std::string_view input)
+	{
+		ADVENT_TRACE_SCOPE("day22::parse");
+		std::vector<Secret> secrets;
+		secrets.reserve(2000);
+		for (std::string_view line : utils::string_line_range{ input })
+		{
+			line = utils::trim_string(line);
+			if (line.empty()) continue;
+			secrets.push_back(utils::to_value<Secret>(line));
+		}
+		return secrets;
+	}
+
+	uint64_t solve_p1(const std::vector<Secret>& secrets, std::size_t steps)
+	{
+		ADVENT_TRACE_SCOPE("day22::randomise");
+		return std::transform_reduce(policy, begin(secrets), end(secrets), Secret{0u}, std::plus<Secret>{}, [steps](Secret s) {return randomise(s, steps); });
+	}
+
 	uint64_t solve_p1(std::istream& input, std::size_t steps)
 	{
-		using SII = std::istream_iterator<Secret>;
 		const std::vector<Secret> secrets = get_all_initial_secrets(input);
-		return std::transform_reduce(policy, begin(secrets), end(secrets), Secret{0u}, std::plus<Secret>{}, [steps](Secret s) {return randomise(s, steps); });
+		return solve_p1(secrets, steps);
 	}
 }
 
@@ -110,6 +135,7 @@ namespace
 
 	MerchantSummary get_all_prices(Secret initial_secret)
 	{
+		ADVENT_TRACE_SCOPE("day22::merchant");
 		Secret current_secret = initial_secret;
 		Price latest_price = price(current_secret);
 		PriceDeltaSequence current_sequence;
@@ -132,9 +158,9 @@ namespace
 		return result;
 	}
 
-	std::vector<MerchantSummary> get_all_merchant_summaries(std::istream& input)
+	std::vector<MerchantSummary> get_all_merchant_summaries(const std::vector<Secret>& initial_secrets)
 	{
-		const std::vector<Secret> initial_secrets = get_all_initial_secrets(input);
+		ADVENT_TRACE_SCOPE("day22::merchant_summaries");
 		std::vector<MerchantSummary> result;
 		result.resize(initial_secrets.size());
 		std::transform(policy, begin(initial_secrets), end(initial_secrets), begin(result), get_all_prices);
@@ -143,6 +169,7 @@ namespace
 
 	utils::sorted_vector<PriceDeltaSequence> get_all_sequences(const std::vector<MerchantSummary>& all_price_sequences)
 	{
+		ADVENT_TRACE_SCOPE("day22::collect_sequences");
 		const std::size_t total_size = stdr::fold_left(all_price_sequences | stdv::transform(&MerchantSummary::size), 0u, std::plus<std::size_t>{});
 		utils::sorted_vector<PriceDeltaSequence> result;
 		result.reserve(total_size);
@@ -165,13 +192,20 @@ namespace
 		return stdr::fold_left(all_summaries | stdv::transform([sequence](const MerchantSummary& ms) {return get_single_price(ms, sequence); }), int64_t{ 0 }, std::plus<int64_t>{});
 	}
 
-	int64_t solve_p2(std::istream& input)
+	int64_t solve_p2(const std::vector<Secret>& initial_secrets)
 	{
-		const std::vector<MerchantSummary> all_summaries = get_all_merchant_summaries(input);
+		const std::vector<MerchantSummary> all_summaries = get_all_merchant_summaries(initial_secrets);
 		const utils::sorted_vector<PriceDeltaSequence> sequences_to_check = get_all_sequences(all_summaries);
+		ADVENT_TRACE_SCOPE("day22::best_sequence");
 
 		return std::transform_reduce(policy, begin(sequences_to_check), end(sequences_to_check), int64_t{ 0 }, utils::Larger<int64_t>{}, [&all_summaries](PriceDeltaSequence pds) {return get_combined_price(all_summaries, pds); });
 	}
+
+	int64_t solve_p2(std::istream& input)
+	{
+		const std::vector<Secret> initial_secrets = get_all_initial_secrets(input);
+		return solve_p2(initial_secrets);
+	}
 }
 
 ResultType advent_22::p1(std::istream& input, std::size_t steps)
@@ -186,14 +220,24 @@ ResultType day_twentytwo_p2(std::istream& input)
 
 ResultType advent_twentytwo_p1()
 {
-	auto input = advent::open_puzzle_input(22);
-	return solve_p1(input, 2000u);
+	const auto secrets = advent::get_cached_puzzle_model<std::vector<Secret>>(22, [](std::istream& input) { return get_all_initial_secrets(input); });
+	return solve_p1(*secrets, 2000u);
 }
 
 ResultType advent_twentytwo_p2()
 {
-	auto input = advent::open_puzzle_input(22);
-	return solve_p2(input);
+	const auto secrets = advent::get_cached_puzzle_model<std::vector<Secret>>(22, [](std::istream& input) { return get_all_initial_secrets(input); });
+	return solve_p2(*secrets);
+}
+
+ResultType advent_22::p1(std::string_view input)
+{
+	return solve_p1(get_all_initial_secrets(input), 2000u);
+}
+
+ResultType advent_22::p2(std::string_view input)
+{
+	return solve_p2(get_all_initial_secrets(input));
 }
 
 #undef DAY22DBG
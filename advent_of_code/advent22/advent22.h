@@ -2,9 +2,13 @@
 
 #include "advent/advent_types.h"
 
+#include <string_view>
+
 namespace advent_22
 {
 	ResultType p1(std::istream& input, std::size_t steps);
+	ResultType p1(std::string_view input);
+	ResultType p2(std::string_view input);
 }
 
 template <std::size_t STEPS>
@@ -333,5 +333,17 @@ ResultType advent_twentythree_p2()
 	return solve_p2(input);
 }
 
+ResultType advent_23::p1(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p1(stream);
+}
+
+ResultType advent_23::p2(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p2(stream);
+}
+
 #undef DAY23DBG
 #undef ENABLE_DAY23DBG
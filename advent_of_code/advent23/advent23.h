@@ -2,8 +2,16 @@
 
 #include "advent/advent_types.h"
 
+#include <string_view>
+
 ResultType day_twentythree_p1(std::istream&);
 ResultType day_twentythree_p2(std::istream&);
 
+namespace advent_23
+{
+	ResultType p1(std::string_view input);
+	ResultType p2(std::string_view input);
+}
+
 ResultType advent_twentythree_p1();
 ResultType advent_twentythree_p2();
@@ -398,5 +398,17 @@ ResultType advent_twentyfour_p2()
 	return solve_p2(input);
 }
 
+ResultType advent_24::p1(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p1(stream);
+}
+
+ResultType advent_24::p2(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p2(stream);
+}
+
 #undef DAY24DBG
 #undef ENABLE_DAY24DBG
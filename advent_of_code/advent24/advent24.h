@@ -2,7 +2,15 @@
 
 #include "advent/advent_types.h"
 
+#include <string_view>
+
 ResultType day_twentyfour_p1(std::istream&);
 
+namespace advent_24
+{
+	ResultType p1(std::string_view input);
+	ResultType p2(std::string_view input);
+}
+
 ResultType advent_twentyfour_p1();
 ResultType advent_twentyfour_p2();
@@ -2,5 +2,13 @@
 
 #include "advent/advent_types.h"
 
+#include <string_view>
+
+namespace advent_25
+{
+	ResultType p1(std::string_view input);
+	ResultType p2(std::string_view input);
+}
+
 ResultType advent_twentyfive_p1();
 ResultType advent_twentyfive_p2();
@@ -127,6 +127,11 @@ namespace
 	{
 		return get_multiples(input, false);
 	}
+
+	int64_t solve_p1(std::string_view input)
+	{
+		return get_multiples(input, false);
+	}
 }
 
 namespace
@@ -135,6 +140,11 @@ namespace
 	{
 		return get_multiples(input, true);
 	}
+
+	int64_t solve_p2(std::string_view input)
+	{
+		return get_multiples(input, true);
+	}
 }
 
 ResultType day_three_p1_a(std::istream& input)
@@ -150,12 +160,22 @@ ResultType day_three_p2_a(std::istream& input)
 ResultType advent_three_p1()
 {
 	auto input = advent::open_puzzle_input(3);
-	return solve_p1(input);
+	return solve_p1(input.view());
 }
 
 ResultType advent_three_p2()
 {
 	auto input = advent::open_puzzle_input(3);
+	return solve_p2(input.view());
+}
+
+ResultType advent_3::p1(std::string_view input)
+{
+	return solve_p1(input);
+}
+
+ResultType advent_3::p2(std::string_view input)
+{
 	return solve_p2(input);
 }
 
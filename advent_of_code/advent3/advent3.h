@@ -2,8 +2,16 @@
 
 #include "advent/advent_types.h"
 
+#include <string_view>
+
 ResultType day_three_p1_a(std::istream&);
 ResultType day_three_p2_a(std::istream&);
 
+namespace advent_3
+{
+	ResultType p1(std::string_view input);
+	ResultType p2(std::string_view input);
+}
+
 ResultType advent_three_p1();
 ResultType advent_three_p2();
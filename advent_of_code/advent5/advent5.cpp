@@ -276,5 +276,17 @@ ResultType advent_five_p2()
 	return solve_p2(input);
 }
 
+ResultType advent_5::p1(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p1(stream);
+}
+
+ResultType advent_5::p2(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p2(stream);
+}
+
 #undef DAY5DBG
 #undef ENABLE_DAY5DBG
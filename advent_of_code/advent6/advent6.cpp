@@ -30,6 +30,8 @@ namespace
 #include "line.h"
 #include "transform_if.h"
 
+#include "advent/advent_cancellation.h"
+
 #include <execution>
 #include <map>
 #include <vector>
@@ -100,6 +102,16 @@ namespace
 
 		// If this returns nullopt it's because it looped.
 		std::optional<Path> create_guard_path() const
+		{
+			const advent::cancellation_token cancellation = advent::get_cancellation_token();
+			std::optional<Path> result = create_guard_path(cancellation);
+			cancellation.throw_if_cancelled();
+			return result;
+		}
+
+		// As above, but safe to call from a parallel algorithm: once cancelled it gives up and returns nullopt
+		// rather than throwing. The caller has to check the token before trusting the result.
+		std::optional<Path> create_guard_path(advent::cancellation_token cancellation) const
 		{
 			utils::sorted_vector<std::pair<Coords, Dir>> loop_detector;
 			Coords gl = guard_location;
@@ -107,6 +119,7 @@ namespace
 			Path result;
 			while (true)
 			{
+				if (cancellation.is_cancelled()) return std::nullopt;
 				{
 					const std::pair ref{ gl,gd };
 					auto loop_detection_result = loop_detector.lower_bound(ref);
@@ -270,32 +283,37 @@ namespace
 		return result;
 	}
 
-	int64_t solve_p1(std::istream& input)
+	int64_t solve_p1(const GameState& state)
 	{
-		const GameState state = parse_game_state(input);
 		const std::optional<Path> path = state.create_guard_path();
 		AdventCheck(path.has_value());
 		const std::size_t result = get_path_coverage(path.value());
 		return result;
 	}
+
+	int64_t solve_p1(std::istream& input)
+	{
+		const GameState state = parse_game_state(input);
+		return solve_p1(state);
+	}
 }
 
 namespace
 {
-	bool has_loop(const GameState& state)
+	bool has_loop(const GameState& state, advent::cancellation_token cancellation)
 	{
-		const std::optional<Path> path = state.create_guard_path();
+		const std::optional<Path> path = state.create_guard_path(cancellation);
 		return !path.has_value();
 	}
 
-	bool has_loop_with_obstacle(GameState state, Coords new_obstacle)
+	bool has_loop_with_obstacle(GameState state, Coords new_obstacle, advent::cancellation_token cancellation)
 	{
 		AdventCheck(new_obstacle != state.get_guard_start_location());
 		state.add_obstacle(new_obstacle);
-		return has_loop(state);
+		return has_loop(state, cancellation);
 	}
 
-	int64_t count_locations_to_add_obstacles_on_line(const GameState& state, const Path& path, std::size_t line_idx)
+	int64_t count_locations_to_add_obstacles_on_line(const GameState& state, const Path& path, std::size_t line_idx, advent::cancellation_token cancellation)
 	{
 		AdventCheck(line_idx < path.size());
 		const Line line = path[line_idx];
@@ -319,12 +337,14 @@ namespace
 				return stdr::any_of(crossings, [location](Line l) {return l.is_on_line(location); });
 			};
 
-		auto can_add_obstacle = [&already_checked,&state,&line](std::size_t idx)
+		// This runs in parallel, so it can't throw when cancelled. Give up on each location instead.
+		auto can_add_obstacle = [&already_checked,&state,&line,cancellation](std::size_t idx)
 			{
+				if (cancellation.is_cancelled()) return false;
 				const Coords obstacle_loc = line[idx];
 				if (obstacle_loc == state.get_guard_start_location()) return false;
 				if (already_checked(obstacle_loc)) return false;
-				return has_loop_with_obstacle(state, obstacle_loc);
+				return has_loop_with_obstacle(state, obstacle_loc, cancellation);
 			};
 
 		const utils::int_range line_range{ line.size() };
@@ -332,20 +352,27 @@ namespace
 		return result;
 	}
 
-	int64_t solve_p2(std::istream& input)
+	int64_t solve_p2(const GameState& state)
 	{
-		const GameState state = parse_game_state(input);
 		const std::optional<Path> o_unlooped_path = state.create_guard_path();
 		AdventCheck(o_unlooped_path.has_value());
 		const Path& path = o_unlooped_path.value();
 		const utils::int_range path_range{ path.size() };
-		auto count_positions = [&state, &path](std::size_t path_idx)
+		const advent::cancellation_token cancellation = advent::get_cancellation_token();
+		auto count_positions = [&state, &path, cancellation](std::size_t path_idx)
 			{
-				return count_locations_to_add_obstacles_on_line(state, path, path_idx);
+				return count_locations_to_add_obstacles_on_line(state, path, path_idx, cancellation);
 			};
 		const int64_t result = std::transform_reduce(std::execution::par_unseq, begin(path_range), end(path_range), int64_t{ 0 }, std::plus<int64_t>{}, count_positions);
+		cancellation.throw_if_cancelled();
 		return result;
 	}
+
+	int64_t solve_p2(std::istream& input)
+	{
+		const GameState state = parse_game_state(input);
+		return solve_p2(state);
+	}
 }
 
 ResultType day_six_p1_a(std::istream& input)
@@ -360,14 +387,26 @@ ResultType day_six_p2_a(std::istream& input)
 
 ResultType advent_six_p1()
 {
-	auto input = advent::open_puzzle_input(6);
-	return solve_p1(input);
+	const auto state = advent::get_cached_puzzle_model<GameState>(6, parse_game_state);
+	return solve_p1(*state);
 }
 
 ResultType advent_six_p2()
 {
-	auto input = advent::open_puzzle_input(6);
-	return solve_p2(input);
+	const auto state = advent::get_cached_puzzle_model<GameState>(6, parse_game_state);
+	return solve_p2(*state);
+}
+
+ResultType advent_6::p1(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p1(stream);
+}
+
+ResultType advent_6::p2(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p2(stream);
 }
 
 #undef DAY6DBG
@@ -33,6 +33,8 @@ namespace
 #include "int_range.h"
 #include "count_digits.h"
 
+#include "advent/advent_cancellation.h"
+
 namespace
 {
 	enum class Operation : uint8_t
@@ -69,6 +71,7 @@ namespace
 	template <AdventDay Day>
 	bool has_solution_impl(TargetType partial_solution, ValueList::const_reverse_iterator vals_begin, ValueList::const_reverse_iterator vals_end)
 	{
+		advent::throw_if_cancelled();
 		if (vals_begin == vals_end) return (partial_solution == TargetType{ 0 });
 		if (partial_solution < 0) return false;
 
@@ -159,5 +162,17 @@ ResultType advent_seven_p2()
 	return solve_p2(input);
 }
 
+ResultType advent_7::p1(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p1(stream);
+}
+
+ResultType advent_7::p2(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p2(stream);
+}
+
 #undef DAY7DBG
 #undef ENABLE_DAY7DBG
@@ -246,5 +246,17 @@ ResultType advent_eight_p2()
 	return solve_p2(input);
 }
 
+ResultType advent_8::p1(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p1(stream);
+}
+
+ResultType advent_8::p2(std::string_view input)
+{
+	auto stream = advent::open_view_stream(input);
+	return solve_p2(stream);
+}
+
 #undef DAY8DBG
 #undef ENABLE_DAY8DBG
@@ -30,6 +30,7 @@ namespace
 
 #include <vector>
 #include <span>
+#include <cctype>
 
 namespace
 {
@@ -44,6 +45,20 @@ namespace
 		return result;
 	}
 
+	BlockStorage get_input(std::string_view input)
+	{
+		BlockStorage result;
+		result.reserve(input.size());
+		for (char c : input)
+		{
+			const unsigned char uc = static_cast<unsigned char>(c);
+			if (std::isspace(uc)) continue;
+			AdventCheckMsg(std::isdigit(uc), "Unexpected character in disk map:", c);
+			result.push_back(static_cast<int8_t>(c - '0'));
+		}
+		return result;
+	}
+
 	uint64_t get_partial_checksum(std::size_t file_id, std::size_t block_len, std::size_t starting_idx)
 	{
 		/*
@@ -151,6 +166,13 @@ namespace
 		const BlockView view(blocks);
 		return solve_p1(view);
 	}
+
+	uint64_t solve_p1(std::string_view input)
+	{
+		BlockStorage blocks = get_input(input);
+		const BlockView view(blocks);
+		return solve_p1(view);
+	}
 }
 
 namespace
@@ -279,6 +301,11 @@ namespace
 	{
 		return solve_p2(get_input(input));
 	}
+
+	uint64_t solve_p2(std::string_view input)
+	{
+		return solve_p2(get_input(input));
+	}
 }
 
 namespace
@@ -323,12 +350,22 @@ ResultType day_nine_p2_b()
 ResultType advent_nine_p1()
 {
 	auto input = advent::open_puzzle_input(9);
-	return solve_p1(input);
+	return solve_p1(input.view());
 }
 
 ResultType advent_nine_p2()
 {
 	auto input = advent::open_puzzle_input(9);
+	return solve_p2(input.view());
+}
+
+ResultType advent_9::p1(std::string_view input)
+{
+	return solve_p1(input);
+}
+
+ResultType advent_9::p2(std::string_view input)
+{
 	return solve_p2(input);
 }
 
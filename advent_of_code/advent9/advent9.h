@@ -2,6 +2,8 @@
 
 #include "advent/advent_types.h"
 
+#include <string_view>
+
 ResultType day_nine_p1_a();
 ResultType day_nine_p1_b();
 
@@ -10,5 +12,11 @@ ResultType day_nine_p2_b();
 
 
 
+namespace advent_9
+{
+	ResultType p1(std::string_view input);
+	ResultType p2(std::string_view input);
+}
+
 ResultType advent_nine_p1();
 ResultType advent_nine_p2();
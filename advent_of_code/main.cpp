@@ -1,29 +1,289 @@
 #include "advent/advent_of_code.h"
+#include "advent/advent_utils.h"
+#include "advent/advent_trace.h"
+#include "advent/advent_input_generators.h"
+#include "advent/advent_server.h"
+#include "advent/advent_mapped_input.h"
+#include "advent/advent_assert.h"
+#include "advent/advent_command_line.h"
 
 #include <iostream>
+#include <fstream>
 #include <vector>
+#include <string>
+#include <thread>
+#include <algorithm>
+#include <optional>
+#include <cmath>
+#include <chrono>
+
+namespace
+{
+	int print_usage()
+	{
+		std::cerr << "Usage: advent2024 [FILTER...] [--jobs N] [--bench] [--warmup K] [--reps N] [--allocs] [--perf] [--isolate]\n"
+			"                  [--timeout S] [--trace FILE] [--json FILE] [--csv FILE] [--compare FILE] [--threshold P] [--no-cache]\n"
+			"   or: advent2024 batch DAY PART PATH [--jobs N]\n"
+			"   or: advent2024 serve SOCKET [--jobs N]\n"
+			"   or: advent2024 client SOCKET DAY PART FILE\n"
+			"   or: advent2024 client SOCKET shutdown\n"
+			"   or: advent2024 generate DAY SCALE FILE [--seed N]\n";
+		return 1;
+	}
+
+	// Reads a number from the command line, saying what was wrong if it isn't one.
+	template <typename T>
+	std::optional<T> read_number(std::string_view name, std::string_view arg)
+	{
+		const std::optional<T> result = advent::parse_command_line_value<T>(arg);
+		if (!result.has_value())
+		{
+			std::cerr << "ERROR: " << name << " must be a number, not '" << arg << "'.\n";
+		}
+		return result;
+	}
+}
 
 int main(int argc, char** argv)
 {
 	std::cout.sync_with_stdio(false);
 
+	// Batch mode: advent2024 batch DAY PART PATH [--jobs N]
+	// Runs one day's solution on every file in PATH (a directory, or a file name with * and ? wildcards)
+	// and reports the throughput. Uses one job per hardware thread unless told otherwise.
+	if(argc >= 5 && std::string_view{ argv[1] } == "batch")
+	{
+		batch_options batch;
+		const std::optional<int> day = read_number<int>("DAY", argv[2]);
+		const std::optional<int> part = read_number<int>("PART", argv[3]);
+		if(!day.has_value() || !part.has_value()) return print_usage();
+		batch.day = *day;
+		batch.part = *part;
+		batch.input_pattern = argv[4];
+		batch.num_jobs = std::max(std::thread::hardware_concurrency(), 1u);
+		for(int i=5;i+1<argc;++i)
+		{
+			if(std::string_view{ argv[i] } == "--jobs")
+			{
+				const std::optional<std::size_t> num_jobs = read_number<std::size_t>("--jobs", argv[++i]);
+				if(!num_jobs.has_value()) return print_usage();
+				batch.num_jobs = *num_jobs > 0u ? *num_jobs : batch.num_jobs;
+			}
+		}
+		return run_batch(batch) ? 0 : 1;
+	}
+
+	// Server mode: advent2024 serve SOCKET [--jobs N]
+	// Listens on a Unix domain socket and runs solutions on request, keeping caches warm between requests.
+	// See advent_server.h for the protocol.
+	if(argc >= 3 && std::string_view{ argv[1] } == "serve")
+	{
+		advent::server_options server;
+		server.socket_path = argv[2];
+		server.num_jobs = std::max(std::thread::hardware_concurrency(), 1u);
+		for(int i=3;i+1<argc;++i)
+		{
+			if(std::string_view{ argv[i] } == "--jobs")
+			{
+				const std::optional<std::size_t> num_jobs = read_number<std::size_t>("--jobs", argv[++i]);
+				if(!num_jobs.has_value()) return print_usage();
+				server.num_jobs = *num_jobs > 0u ? *num_jobs : server.num_jobs;
+			}
+		}
+		return advent::run_server(server) ? 0 : 1;
+	}
+
+	// Client mode: advent2024 client SOCKET DAY PART FILE
+	//          or: advent2024 client SOCKET shutdown
+	// Sends FILE to a running server and prints the answer.
+	if(argc >= 4 && std::string_view{ argv[1] } == "client")
+	{
+		try
+		{
+			if(std::string_view{ argv[3] } == "shutdown")
+			{
+				advent::send_server_shutdown(argv[2]);
+				return 0;
+			}
+			if(argc < 6)
+			{
+				return print_usage();
+			}
+			const std::optional<int> day = read_number<int>("DAY", argv[3]);
+			const std::optional<int> part = read_number<int>("PART", argv[4]);
+			if(!day.has_value() || !part.has_value()) return print_usage();
+			const advent::mapped_input input{ argv[5] };
+			const advent::server_response response = advent::send_server_request(argv[2], *day, *part, input.view());
+			(response.succeeded ? std::cout : std::cerr) << response.result << '\n';
+			return response.succeeded ? 0 : 1;
+		}
+		catch(const advent::test_failed& tf)
+		{
+			std::cerr << "ERROR: " << tf.what() << '\n';
+			return 1;
+		}
+	}
+
+	// Generate mode: advent2024 generate DAY SCALE FILE [--seed N]
+	// Writes a synthetic input for the day to FILE, SCALE times the size of a real puzzle input.
+	// Inputs are the same every time for the same seed, so they can be used for repeatable benchmarks.
+	if(argc >= 5 && std::string_view{ argv[1] } == "generate")
+	{
+		const std::optional<int> day = read_number<int>("DAY", argv[2]);
+		const std::optional<int> scale = read_number<int>("SCALE", argv[3]);
+		if(!day.has_value() || !scale.has_value()) return print_usage();
+		if(*scale < 1)
+		{
+			std::cerr << "ERROR: SCALE must be at least 1.\n";
+			return print_usage();
+		}
+		uint64_t seed = advent::default_generator_seed;
+		for(int i=5;i+1<argc;++i)
+		{
+			if(std::string_view{ argv[i] } == "--seed")
+			{
+				const std::optional<uint64_t> parsed_seed = read_number<uint64_t>("--seed", argv[++i]);
+				if(!parsed_seed.has_value()) return print_usage();
+				seed = *parsed_seed;
+			}
+		}
+		if(!advent::can_generate_input(*day))
+		{
+			std::cerr << "No input generator for day " << *day << ": " << advent::get_missing_generator_reason(*day) << '\n';
+			return 1;
+		}
+		std::ofstream output{ argv[4], std::ios::binary };
+		output << advent::generate_input(*day, *scale, seed);
+		return output.good() ? 0 : 1;
+	}
+
 	// Use the filter to only run certain tests.
 	// This uses some magic to test against the name of the function,
 	// so putting "eighteen" as the argument will only run advent_eighteen_p1()
 	// and advent_eighteen_p2() (as well as any other test functions with "eighteen"
 	// in the function name.
 	// Leave blank to run everything.
-	std::vector<std::string_view> filters;
+	//
+	// Options:
+	//     --jobs N   : Run up to N tests at once. 0 uses one per hardware thread.
+	//     --bench    : Benchmark mode. Run each test repeatedly and report timing statistics. Turns off input caching.
+	//     --warmup K : In benchmark mode, do K untimed runs of each test first.
+	//     --reps N   : In benchmark mode, time N runs of each test.
+	//     --allocs   : Count the heap allocations each test makes.
+	//     --perf     : Read hardware performance counters around each test (Linux only).
+	//     --isolate  : Run each test in a forked process and report its peak memory and page faults (POSIX only).
+	//     --timeout S    : Cancel any test which runs for longer than S seconds and report it as a TIMEOUT.
+	//     --trace FILE   : Record ADVENT_TRACE_SCOPE timings and write them to FILE as Chrome trace JSON on exit.
+	//     --json FILE    : Write results to FILE as JSON.
+	//     --csv FILE     : Write results to FILE as CSV.
+	//     --compare FILE : Compare times against a JSON file from a previous run. Regressions count as failures.
+	//     --threshold P  : With --compare, how many percent slower a test may get before it counts as a regression.
+	//     --no-cache     : Read and parse the puzzle input afresh for every test instead of sharing it between parts.
+	verification_options options;
 	for(int i=1;i<argc;++i)
 	{
-		filters.push_back(argv[i]);
+		const std::string_view arg{ argv[i] };
+		if(arg == "--jobs" && i + 1 < argc)
+		{
+			const std::optional<std::size_t> num_jobs = read_number<std::size_t>(arg, argv[++i]);
+			if(!num_jobs.has_value()) return print_usage();
+			options.num_jobs = *num_jobs > 0u ? *num_jobs : std::max(std::thread::hardware_concurrency(), 1u);
+			continue;
+		}
+		if(arg == "--bench")
+		{
+			options.benchmark = true;
+			continue;
+		}
+		if(arg == "--warmup" && i + 1 < argc)
+		{
+			const std::optional<std::size_t> num_warmups = read_number<std::size_t>(arg, argv[++i]);
+			if(!num_warmups.has_value()) return print_usage();
+			options.benchmark_warmups = *num_warmups;
+			continue;
+		}
+		if(arg == "--reps" && i + 1 < argc)
+		{
+			const std::optional<std::size_t> num_repetitions = read_number<std::size_t>(arg, argv[++i]);
+			if(!num_repetitions.has_value()) return print_usage();
+			options.benchmark_repetitions = std::max(*num_repetitions, std::size_t{ 1u });
+			continue;
+		}
+		if(arg == "--allocs")
+		{
+			options.track_allocations = true;
+			continue;
+		}
+		if(arg == "--perf")
+		{
+			options.hardware_counters = true;
+			continue;
+		}
+		if(arg == "--isolate")
+		{
+			options.isolate = true;
+			continue;
+		}
+		if(arg == "--timeout" && i + 1 < argc)
+		{
+			const std::optional<double> seconds = read_number<double>(arg, argv[++i]);
+			if(!seconds.has_value()) return print_usage();
+			if(!std::isfinite(*seconds) || *seconds < 0.0)
+			{
+				std::cerr << "ERROR: --timeout must be a number of seconds, not '" << argv[i] << "'.\n";
+				return print_usage();
+			}
+			// The watchdog adds the timeout to steady_clock::now(), so keep well inside what a steady_clock::duration
+			// can hold. That's far less than std::chrono::milliseconds::max(), and still over a century.
+			const double max_seconds = std::chrono::duration<double>{ std::chrono::steady_clock::duration::max() }.count() / 2.0;
+			if(*seconds > max_seconds)
+			{
+				std::cerr << "ERROR: --timeout can be at most " << static_cast<int64_t>(max_seconds) << " seconds, not '" << argv[i] << "'.\n";
+				return print_usage();
+			}
+			options.timeout = std::chrono::milliseconds{ static_cast<int64_t>(*seconds * 1000.0) };
+			continue;
+		}
+		if(arg == "--trace" && i + 1 < argc)
+		{
+			advent::trace::write_at_exit(argv[++i]);
+			continue;
+		}
+		if(arg == "--json" && i + 1 < argc)
+		{
+			options.json_output_path = argv[++i];
+			continue;
+		}
+		if(arg == "--csv" && i + 1 < argc)
+		{
+			options.csv_output_path = argv[++i];
+			continue;
+		}
+		if(arg == "--compare" && i + 1 < argc)
+		{
+			options.baseline_path = argv[++i];
+			continue;
+		}
+		if(arg == "--threshold" && i + 1 < argc)
+		{
+			const std::optional<double> percent = read_number<double>(arg, argv[++i]);
+			if(!percent.has_value()) return print_usage();
+			options.regression_threshold = *percent / 100.0;
+			continue;
+		}
+		if(arg == "--no-cache")
+		{
+			advent::set_input_caching_enabled(false);
+			continue;
+		}
+		options.filters.push_back(arg);
 	}
 
-	verify_all(filters);
+	const bool all_passed = verify_all(options);
 
 #ifndef WIN32
 	std::cout << "Program finished. Press any key to continue.";
 	std::cin.get();
 #endif
-	return 0;
+	return all_passed ? 0 : 1;
 }
\ No newline at end of file
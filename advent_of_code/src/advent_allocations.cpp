@@ -0,0 +1,168 @@
+#include "advent/advent_allocations.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#elif defined(__APPLE__)
+#include <malloc/malloc.h>
+#else
+#include <malloc.h>
+#endif
+
+namespace
+{
+	// These are all constant-initialised, so they are safe to use from allocations made before main.
+	std::atomic_bool tracking_enabled{ false };
+	std::atomic<int64_t> num_allocations{ 0 };
+	std::atomic<int64_t> bytes_allocated{ 0 };
+	std::atomic<int64_t> live_bytes{ 0 };
+	std::atomic<int64_t> peak_live_bytes{ 0 };
+
+	// Frees only know the pointer, so live bytes are measured with the size the allocator actually reserved.
+	std::size_t get_usable_size(void* ptr, std::align_val_t alignment)
+	{
+#if defined(_WIN32)
+		return alignment > std::align_val_t{ __STDCPP_DEFAULT_NEW_ALIGNMENT__ }
+			? _aligned_msize(ptr, static_cast<std::size_t>(alignment), 0)
+			: _msize(ptr);
+#elif defined(__APPLE__)
+		static_cast<void>(alignment);
+		return malloc_size(ptr);
+#else
+		static_cast<void>(alignment);
+		return malloc_usable_size(ptr);
+#endif
+	}
+
+	void record_allocation(void* ptr, std::size_t size, std::align_val_t alignment)
+	{
+		if (ptr == nullptr || !tracking_enabled.load(std::memory_order_relaxed)) return;
+		num_allocations.fetch_add(1, std::memory_order_relaxed);
+		bytes_allocated.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed);
+		const int64_t usable_size = static_cast<int64_t>(get_usable_size(ptr, alignment));
+		const int64_t now_live = live_bytes.fetch_add(usable_size, std::memory_order_relaxed) + usable_size;
+		int64_t peak = peak_live_bytes.load(std::memory_order_relaxed);
+		while (now_live > peak && !peak_live_bytes.compare_exchange_weak(peak, now_live, std::memory_order_relaxed)) {}
+	}
+
+	void record_free(void* ptr, std::align_val_t alignment)
+	{
+		if (ptr == nullptr || !tracking_enabled.load(std::memory_order_relaxed)) return;
+		// The block may have been allocated before the last reset_stats, which never added it to live bytes.
+		// Frees can't tell, so never let them take live bytes below zero: otherwise the allocations that follow
+		// would have to fill the hole before they counted towards the peak.
+		const int64_t usable_size = static_cast<int64_t>(get_usable_size(ptr, alignment));
+		int64_t live = live_bytes.load(std::memory_order_relaxed);
+		while (!live_bytes.compare_exchange_weak(live, std::max(live - usable_size, int64_t{ 0 }), std::memory_order_relaxed)) {}
+	}
+
+	constexpr std::align_val_t default_alignment{ __STDCPP_DEFAULT_NEW_ALIGNMENT__ };
+
+	void* allocate(std::size_t size, std::align_val_t alignment) noexcept
+	{
+		// operator new must return a unique pointer even for zero bytes.
+		size = size > 0u ? size : 1u;
+		void* result = nullptr;
+		if (alignment <= default_alignment)
+		{
+			result = std::malloc(size);
+		}
+		else
+		{
+			const std::size_t align = static_cast<std::size_t>(alignment);
+#if defined(_WIN32)
+			result = _aligned_malloc(size, align);
+#else
+			// aligned_alloc wants the size to be a multiple of the alignment.
+			result = std::aligned_alloc(align, (size + align - 1u) / align * align);
+#endif
+		}
+		record_allocation(result, size, alignment);
+		return result;
+	}
+
+	void* allocate_or_throw(std::size_t size, std::align_val_t alignment)
+	{
+		while (true)
+		{
+			if (void* result = allocate(size, alignment))
+			{
+				return result;
+			}
+			std::new_handler handler = std::get_new_handler();
+			if (handler == nullptr)
+			{
+				throw std::bad_alloc{};
+			}
+			handler();
+		}
+	}
+
+	void deallocate(void* ptr, std::align_val_t alignment) noexcept
+	{
+		record_free(ptr, alignment);
+#if defined(_WIN32)
+		if (alignment > default_alignment)
+		{
+			_aligned_free(ptr);
+			return;
+		}
+#endif
+		std::free(ptr);
+	}
+}
+
+void advent::allocations::set_tracking_enabled(bool enabled)
+{
+	tracking_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool advent::allocations::is_tracking_enabled()
+{
+	return tracking_enabled.load(std::memory_order_relaxed);
+}
+
+void advent::allocations::reset_stats()
+{
+	num_allocations.store(0, std::memory_order_relaxed);
+	bytes_allocated.store(0, std::memory_order_relaxed);
+	live_bytes.store(0, std::memory_order_relaxed);
+	peak_live_bytes.store(0, std::memory_order_relaxed);
+}
+
+advent::allocations::allocation_stats advent::allocations::get_stats()
+{
+	allocation_stats result;
+	result.num_allocations = num_allocations.load(std::memory_order_relaxed);
+	result.bytes_allocated = bytes_allocated.load(std::memory_order_relaxed);
+	result.peak_live_bytes = peak_live_bytes.load(std::memory_order_relaxed);
+	return result;
+}
+
+// Replacements for the global allocation functions. Every form is replaced so none of them
+// bypass the counters, whichever ones the standard library forwards to.
+void* operator new(std::size_t size) { return allocate_or_throw(size, default_alignment); }
+void* operator new[](std::size_t size) { return allocate_or_throw(size, default_alignment); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return allocate_or_throw(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return allocate_or_throw(size, alignment); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return allocate(size, default_alignment); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return allocate(size, default_alignment); }
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return allocate(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return allocate(size, alignment); }
+
+void operator delete(void* ptr) noexcept { deallocate(ptr, default_alignment); }
+void operator delete[](void* ptr) noexcept { deallocate(ptr, default_alignment); }
+void operator delete(void* ptr, std::size_t) noexcept { deallocate(ptr, default_alignment); }
+void operator delete[](void* ptr, std::size_t) noexcept { deallocate(ptr, default_alignment); }
+void operator delete(void* ptr, std::align_val_t alignment) noexcept { deallocate(ptr, alignment); }
+void operator delete[](void* ptr, std::align_val_t alignment) noexcept { deallocate(ptr, alignment); }
+void operator delete(void* ptr, std::size_t, std::align_val_t alignment) noexcept { deallocate(ptr, alignment); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t alignment) noexcept { deallocate(ptr, alignment); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { deallocate(ptr, default_alignment); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { deallocate(ptr, default_alignment); }
+void operator delete(void* ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept { deallocate(ptr, alignment); }
+void operator delete[](void* ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept { deallocate(ptr, alignment); }
\ No newline at end of file
@@ -0,0 +1,218 @@
+#include "advent/advent_benchmark.h"
+#include "advent/advent_assert.h"
+#include "advent/advent_allocations.h"
+
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+#include <variant>
+#include <iterator>
+
+namespace
+{
+	struct ResultStringifier
+	{
+		std::string operator()(const std::string& in) const noexcept { return in; }
+		template <std::integral T>
+		std::string operator()(T in) const { return std::to_string(in); }
+	};
+}
+
+std::string to_string(const ResultType& rt)
+{
+	return std::visit(ResultStringifier{}, rt);
+}
+
+std::string two_digits(int num)
+{
+	std::ostringstream oss;
+	oss << std::setfill('0') << std::setw(2) << num;
+	return oss.str();
+}
+
+std::optional<std::string> to_human_readable(long long count, int inner_max, int outer_max, const std::string& suffix)
+{
+	if (count < inner_max)
+		return std::to_string(count) + suffix;
+
+	if (count < (static_cast<decltype(count)>(inner_max) * static_cast<decltype(count)>(outer_max)))
+	{
+		std::ostringstream oss;
+		oss << count / inner_max << ':' << two_digits(count % inner_max) << suffix;
+		return oss.str();
+	}
+
+	return std::optional<std::string>{};
+}
+
+std::string to_human_readable(std::chrono::hours time)
+{
+	const auto count = time.count();
+	std::ostringstream oss;
+	oss << count / 24 << " days and " << count % 24 << " hours";
+	return oss.str();
+}
+
+std::string to_human_readable(std::chrono::minutes time)
+{
+	const auto res = to_human_readable(time.count(), 60, 24, "s");
+	if (res.has_value())
+		return res.value();
+
+	const auto h = std::chrono::duration_cast<std::chrono::hours>(time);
+	return to_human_readable(h);
+}
+
+std::string to_human_readable(std::chrono::seconds time)
+{
+	const auto res = to_human_readable(time.count(), 60,60,"s");
+	if (res.has_value())
+		return res.value();
+
+	const auto m = std::chrono::duration_cast<std::chrono::minutes>(time);
+	return to_human_readable(m);
+}
+
+std::optional<std::string> to_human_readable(long long count, const std::string& suffix_short, const std::string& suffix_long)
+{
+	if (count < 10'000)
+		return std::to_string(count) + suffix_short;
+	if (count < 100'000)
+	{
+		std::ostringstream oss;
+		oss << std::setprecision(3) << static_cast<double>(count) / 1000.0 << suffix_long;
+		return oss.str();
+	}
+	return std::optional<std::string>{};
+}
+
+std::string to_human_readable(std::chrono::milliseconds time)
+{
+	const auto res = to_human_readable(time.count(), "ms", "s");
+	if (res.has_value())
+		return res.value();
+
+	const auto s = std::chrono::duration_cast<std::chrono::seconds>(time);
+	return to_human_readable(s);
+}
+
+std::string to_human_readable(std::chrono::microseconds time)
+{
+	const auto res = to_human_readable(time.count(), "us", "ms");
+	if (res.has_value())
+		return res.value();
+
+	const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(time);
+	return to_human_readable(ms);
+}
+
+std::string to_human_readable(std::chrono::nanoseconds time)
+{
+	const auto res = to_human_readable(time.count(), "ns", "us");
+	if (res.has_value())
+		return res.value();
+
+	const auto us = std::chrono::duration_cast<std::chrono::microseconds>(time);
+	return to_human_readable(us);
+}
+
+// Uses the nearest-rank method on an already sorted list of samples.
+std::chrono::nanoseconds get_percentile(const std::vector<std::chrono::nanoseconds>& sorted_samples, int percentile)
+{
+	AdventCheck(!sorted_samples.empty());
+	const std::size_t rank = (sorted_samples.size() * percentile + 99) / 100;
+	return sorted_samples[std::max(rank, std::size_t{ 1u }) - 1];
+}
+
+benchmark_stats calculate_benchmark_stats(std::vector<std::chrono::nanoseconds> samples)
+{
+	AdventCheck(!samples.empty());
+	std::ranges::sort(samples);
+	benchmark_stats result;
+	result.num_samples = samples.size();
+	result.min = samples.front();
+	result.median = get_percentile(samples, 50);
+	result.p90 = get_percentile(samples, 90);
+	result.p99 = get_percentile(samples, 99);
+
+	const double mean = std::transform_reduce(begin(samples), end(samples), 0.0, std::plus<double>{},
+		[](std::chrono::nanoseconds sample) { return static_cast<double>(sample.count()); }) / static_cast<double>(samples.size());
+	const double variance = std::transform_reduce(begin(samples), end(samples), 0.0, std::plus<double>{},
+		[mean](std::chrono::nanoseconds sample)
+		{
+			const double diff = static_cast<double>(sample.count()) - mean;
+			return diff * diff;
+		}) / static_cast<double>(samples.size());
+	result.mean = std::chrono::nanoseconds{ static_cast<long long>(mean) };
+	result.stddev = std::chrono::nanoseconds{ static_cast<long long>(std::sqrt(variance)) };
+	return result;
+}
+
+std::string to_string(const benchmark_stats& stats)
+{
+	std::ostringstream oss;
+	oss << "median " << to_human_readable(stats.median)
+		<< " (min " << to_human_readable(stats.min)
+		<< ", mean " << to_human_readable(stats.mean)
+		<< ", p90 " << to_human_readable(stats.p90)
+		<< ", p99 " << to_human_readable(stats.p99)
+		<< ", stddev " << to_human_readable(stats.stddev)
+		<< ", " << stats.num_samples << " runs)";
+	return oss.str();
+}
+
+std::vector<test_counter> get_allocation_counters(int64_t num_runs)
+{
+	const advent::allocations::allocation_stats stats = advent::allocations::get_stats();
+	return std::vector<test_counter>{
+		test_counter{ "allocations", stats.num_allocations / num_runs },
+		test_counter{ "allocated_bytes", stats.bytes_allocated / num_runs },
+		test_counter{ "peak_live_bytes", stats.peak_live_bytes }
+	};
+}
+
+std::string to_string(const std::vector<test_counter>& counters)
+{
+	std::ostringstream oss;
+	for (const test_counter& counter : counters)
+	{
+		oss << (&counter == &counters.front() ? "" : ", ") << counter.name << ' ' << counter.value;
+	}
+	return oss.str();
+}
+
+benchmark_counters::benchmark_counters(bool track_allocations, bool hardware_counters)
+	: m_track_allocations{ track_allocations }
+{
+	if (hardware_counters)
+	{
+		m_perf_counters.emplace();
+		m_perf_counters->start();
+	}
+	if (m_track_allocations)
+	{
+		advent::allocations::reset_stats();
+	}
+}
+
+std::vector<test_counter> benchmark_counters::stop(std::size_t num_runs)
+{
+	std::vector<test_counter> counters;
+	if (m_track_allocations)
+	{
+		counters = get_allocation_counters(static_cast<int64_t>(num_runs));
+	}
+	if (m_perf_counters.has_value())
+	{
+		std::vector<test_counter> perf_counters = m_perf_counters->stop();
+		for (test_counter& counter : perf_counters)
+		{
+			counter.value /= static_cast<int64_t>(num_runs);
+		}
+		std::ranges::move(perf_counters, std::back_inserter(counters));
+		m_perf_counters.reset();
+	}
+	return counters;
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#include "advent/advent_cancellation.h"
+
+#include <algorithm>
+
+advent::watchdog::watchdog()
+	: m_thread{ [this]() { run(); } }
+{
+}
+
+advent::watchdog::~watchdog()
+{
+	{
+		std::scoped_lock lock{ m_mutex };
+		m_stopping = true;
+	}
+	m_signal.notify_all();
+	m_thread.join();
+}
+
+void advent::watchdog::run()
+{
+	std::unique_lock lock{ m_mutex };
+	while (!m_stopping)
+	{
+		if (m_deadlines.empty())
+		{
+			m_signal.wait(lock);
+			continue;
+		}
+
+		const auto first_deadline = begin(m_deadlines);
+		const clock::time_point deadline = first_deadline->first;
+		if (clock::now() < deadline)
+		{
+			// Woken early whenever a watch is added, so a new earlier deadline is picked up.
+			m_signal.wait_until(lock, deadline);
+			continue;
+		}
+		first_deadline->second.flag->store(true, std::memory_order_relaxed);
+		m_deadlines.erase(first_deadline);
+	}
+}
+
+advent::watchdog::watch::watch(watchdog& owner, std::atomic_bool& flag, clock::duration time_limit)
+	: m_owner{ &owner }, m_deadline{ clock::now() + time_limit }
+{
+	{
+		std::scoped_lock lock{ m_owner->m_mutex };
+		m_id = m_owner->m_next_watch_id++;
+		m_owner->m_deadlines.insert(std::pair{ m_deadline, deadline_entry{ m_id, &flag } });
+	}
+	m_owner->m_signal.notify_all();
+}
+
+advent::watchdog::watch::~watch()
+{
+	std::scoped_lock lock{ m_owner->m_mutex };
+	// Not there if the deadline has passed: the watchdog removed the entry when it set the flag.
+	const auto [first, last] = m_owner->m_deadlines.equal_range(m_deadline);
+	const auto entry = std::find_if(first, last, [this](const auto& deadline) { return deadline.second.watch_id == m_id; });
+	if (entry != last)
+	{
+		m_owner->m_deadlines.erase(entry);
+	}
+}
\ No newline at end of file
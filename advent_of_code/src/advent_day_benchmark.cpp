@@ -0,0 +1,131 @@
+// Stand-alone benchmark for a single day. CMake builds one of these per day (see add_day_benchmark), defining
+// ADVENT_BENCH_DAY, ADVENT_BENCH_HEADER and ADVENT_BENCH_NAMESPACE, and links in nothing but that day's code,
+// the utils it needs and the timing harness. That keeps profiles free of every other day.
+//
+// Usage: advent2024_bench_dayN INPUT [ITERATIONS] [--part P] [--warmup K] [--allocs] [--perf]
+
+#include "advent/advent_benchmark.h"
+#include "advent/advent_mapped_input.h"
+#include "advent/advent_allocations.h"
+#include "advent/advent_platform.h"
+#include "advent/advent_assert.h"
+#include "advent/advent_command_line.h"
+
+#if !defined(ADVENT_BENCH_DAY) || !defined(ADVENT_BENCH_HEADER) || !defined(ADVENT_BENCH_NAMESPACE)
+#error "ADVENT_BENCH_DAY, ADVENT_BENCH_HEADER and ADVENT_BENCH_NAMESPACE must be defined. See add_day_benchmark in CMakeLists.txt."
+#endif
+
+#include ADVENT_BENCH_HEADER
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <algorithm>
+
+namespace
+{
+	struct day_benchmark_options
+	{
+		std::string input_path;
+		std::size_t num_repetitions = 10u;
+		std::size_t num_warmups = 1u;
+		int part = 0; // 0 runs both parts.
+		bool track_allocations = false;
+		bool hardware_counters = false;
+	};
+
+	using solver_func = ResultType(*)(std::string_view);
+
+	bool run_part(int part, solver_func solver, std::string_view input, const day_benchmark_options& options)
+	{
+		try
+		{
+			benchmark_counters counters{ options.track_allocations, options.hardware_counters };
+			const auto [res, stats] = benchmark_function([solver, input]() { return solver(input); }, options.num_warmups, options.num_repetitions);
+			const std::vector<test_counter> counter_values = counters.stop(options.num_warmups + options.num_repetitions);
+			std::cout << "Day " << ADVENT_BENCH_DAY << " part " << part << ": " << to_string(res) << '\n';
+			std::cout << "    " << to_string(stats) << '\n';
+			if (!counter_values.empty())
+			{
+				std::cout << "    " << to_string(counter_values) << '\n';
+			}
+			return true;
+		}
+		catch (const advent::test_failed& tf)
+		{
+			std::cerr << "Day " << ADVENT_BENCH_DAY << " part " << part << " FAILED: " << tf.what() << '\n';
+			return false;
+		}
+	}
+
+	int print_usage(const char* program_name)
+	{
+		std::cerr << "Usage: " << program_name << " INPUT [ITERATIONS] [--part P] [--warmup K] [--allocs] [--perf]\n";
+		return 1;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	std::cout.sync_with_stdio(false);
+	if (argc < 2)
+	{
+		return print_usage(argv[0]);
+	}
+
+	day_benchmark_options options;
+	options.input_path = argv[1];
+	for (int i = 2; i < argc; ++i)
+	{
+		const std::string_view arg{ argv[i] };
+		if (arg == "--part" && i + 1 < argc)
+		{
+			const std::optional<int> part = advent::parse_command_line_value<int>(argv[++i]);
+			if (!part.has_value() || *part < 1 || *part > 2) return print_usage(argv[0]);
+			options.part = *part;
+			continue;
+		}
+		if (arg == "--warmup" && i + 1 < argc)
+		{
+			const std::optional<std::size_t> num_warmups = advent::parse_command_line_value<std::size_t>(argv[++i]);
+			if (!num_warmups.has_value()) return print_usage(argv[0]);
+			options.num_warmups = *num_warmups;
+			continue;
+		}
+		if (arg == "--allocs")
+		{
+			options.track_allocations = true;
+			continue;
+		}
+		if (arg == "--perf")
+		{
+			options.hardware_counters = true;
+			continue;
+		}
+		const std::optional<std::size_t> num_repetitions = advent::parse_command_line_value<std::size_t>(arg);
+		if (!num_repetitions.has_value()) return print_usage(argv[0]);
+		options.num_repetitions = std::max(*num_repetitions, std::size_t{ 1u });
+	}
+
+	const advent::mapped_input input{ options.input_path };
+
+	if (!advent::platform::pin_current_thread_to_core(advent::platform::get_benchmark_core()))
+	{
+		std::cout << "WARNING: Could not pin benchmark thread to a core. Results may be noisier.\n";
+	}
+	advent::allocations::set_tracking_enabled(options.track_allocations);
+
+	bool all_passed = true;
+	if (options.part != 2)
+	{
+		all_passed = run_part(1, &ADVENT_BENCH_NAMESPACE::p1, input.view(), options) && all_passed;
+	}
+	if (options.part != 1)
+	{
+		all_passed = run_part(2, &ADVENT_BENCH_NAMESPACE::p2, input.view(), options) && all_passed;
+	}
+
+	advent::allocations::set_tracking_enabled(false);
+	advent::platform::unpin_current_thread();
+	return all_passed ? 0 : 1;
+}
\ No newline at end of file
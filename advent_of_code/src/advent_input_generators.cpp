@@ -0,0 +1,853 @@
+#include "advent/advent_input_generators.h"
+#include "advent/advent_assert.h"
+
+#include <array>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <limits>
+#include <cmath>
+#include <random>
+#include <algorithm>
+#include <utility>
+#include <format>
+#include <set>
+
+namespace
+{
+	using Random = std::mt19937_64;
+	using Grid = std::vector<std::string>;
+
+	// std::uniform_int_distribution and std::shuffle differ between standard libraries,
+	// but the mt19937_64 sequence does not. Doing these by hand keeps inputs the same on every platform.
+	int random_int(Random& random, int lowest, int highest)
+	{
+		AdventCheck(lowest <= highest);
+		const uint64_t range = static_cast<uint64_t>(highest - lowest) + 1u;
+		return lowest + static_cast<int>(random() % range);
+	}
+
+	bool random_chance(Random& random, int percent)
+	{
+		return random_int(random, 0, 99) < percent;
+	}
+
+	template <typename T>
+	void random_shuffle(std::vector<T>& values, Random& random)
+	{
+		for (std::size_t i = values.size(); i > 1u; --i)
+		{
+			const std::size_t j = random() % i;
+			std::swap(values[i - 1u], values[j]);
+		}
+	}
+
+	std::string to_string(const Grid& grid)
+	{
+		std::string result;
+		for (const std::string& row : grid)
+		{
+			result.append(row);
+			result.push_back('\n');
+		}
+		return result;
+	}
+
+	constexpr std::array<std::pair<int, int>, 4> directions{ std::pair{ 0,-1 }, std::pair{ 1,0 }, std::pair{ 0,1 }, std::pair{ -1,0 } };
+
+	bool in_grid(int x, int y, int width, int height)
+	{
+		return 0 <= x && x < width && 0 <= y && y < height;
+	}
+
+	// Uses an iterative depth-first search to carve a maze into a grid of walls. Cells are at odd coordinates.
+	// Returns the parent of each cell in the search tree and its depth, indexed by cell.
+	struct Maze
+	{
+		int num_cells = 0;
+		std::vector<int> parents;
+		std::vector<int> depths;
+	};
+
+	Maze carve_maze(Grid& grid, Random& random)
+	{
+		const int size = static_cast<int>(grid.size());
+		const int num_cells = (size - 1) / 2;
+		Maze result;
+		result.num_cells = num_cells;
+		result.parents.assign(num_cells * num_cells, -1);
+		result.depths.assign(num_cells * num_cells, -1);
+
+		std::vector<int> stack{ 0 };
+		result.depths[0] = 0;
+		grid[1][1] = '.';
+		while (!stack.empty())
+		{
+			const int cell = stack.back();
+			const int cx = cell % num_cells;
+			const int cy = cell / num_cells;
+			std::array<int, 4> options{};
+			int num_options = 0;
+			for (int dir = 0; dir < 4; ++dir)
+			{
+				const int nx = cx + directions[dir].first;
+				const int ny = cy + directions[dir].second;
+				if (in_grid(nx, ny, num_cells, num_cells) && result.depths[ny * num_cells + nx] < 0)
+				{
+					options[num_options++] = dir;
+				}
+			}
+
+			if (num_options == 0)
+			{
+				stack.pop_back();
+				continue;
+			}
+
+			const auto [dx, dy] = directions[options[random_int(random, 0, num_options - 1)]];
+			const int next = (cy + dy) * num_cells + (cx + dx);
+			grid[2 * cy + 1 + dy][2 * cx + 1 + dx] = '.';
+			grid[2 * (cy + dy) + 1][2 * (cx + dx) + 1] = '.';
+			result.parents[next] = cell;
+			result.depths[next] = static_cast<int>(stack.size());
+			stack.push_back(next);
+		}
+		return result;
+	}
+
+	// The right list repeats some of the left list's numbers, so part two has similarities to add up.
+	std::string generate_day_1(int scale, Random& random)
+	{
+		const int num_lines = 1000 * scale;
+		std::vector<int> left(num_lines);
+		std::ranges::generate(left, [&random]() { return random_int(random, 10000, 99999); });
+		std::string result;
+		for (int i = 0; i < num_lines; ++i)
+		{
+			const int right = random_chance(random, 30) ? left[random_int(random, 0, num_lines - 1)] : random_int(random, 10000, 99999);
+			result.append(std::format("{}   {}\n", left[i], right));
+		}
+		return result;
+	}
+
+	// Mostly steady climbs and falls with the odd bad step, so some reports need the dampener and some can't be saved.
+	std::string generate_day_2(int scale, Random& random)
+	{
+		const int num_reports = 1000 * scale;
+		std::string result;
+		for (int i = 0; i < num_reports; ++i)
+		{
+			const int length = random_int(random, 5, 8);
+			const int direction = random_chance(random, 50) ? 1 : -1;
+			int level = direction > 0 ? random_int(random, 1, 50) : random_int(random, 50, 99);
+			for (int j = 0; j < length; ++j)
+			{
+				if (j > 0) result.push_back(' ');
+				result.append(std::to_string(level));
+				const int step = random_chance(random, 10) ? random_int(random, -4, 4) : direction * random_int(random, 1, 3);
+				level = std::clamp(level + step, 1, 99);
+			}
+			result.push_back('\n');
+		}
+		return result;
+	}
+
+	// Instructions buried in junk, along with some that are nearly right. The numbers are smaller than in the real
+	// input, because the solution adds the products up in an int.
+	std::string generate_day_3(int scale, Random& random)
+	{
+		constexpr std::string_view junk = "mul(,)don't[]{}<>!@#$%^&*+-?:;' whatselectfromwhy";
+		constexpr std::size_t line_length = 3000u;
+		const std::size_t length = 18000u * static_cast<std::size_t>(scale);
+		std::string result;
+		std::size_t line_start = 0u;
+		while (result.size() < length)
+		{
+			const int roll = random_int(random, 0, 99);
+			const int a = random_int(random, 1, 99);
+			const int b = random_int(random, 1, 99);
+			if (roll < 20) result.append(std::format("mul({},{})", a, b));
+			else if (roll < 23) result.append("do()");
+			else if (roll < 26) result.append("don't()");
+			else if (roll < 28) result.append(std::format("mul({} ,{})", a, b));
+			else if (roll < 30) result.append(std::format("mul[{},{}]", a, b));
+			else result.push_back(junk[random_int(random, 0, static_cast<int>(junk.size()) - 1)]);
+
+			if (result.size() - line_start >= line_length)
+			{
+				result.push_back('\n');
+				line_start = result.size();
+			}
+		}
+		result.push_back('\n');
+		return result;
+	}
+
+	std::string generate_day_4(int scale, Random& random)
+	{
+		const int size = 140 * scale;
+		constexpr std::string_view letters = "XMAS";
+		Grid grid(size, std::string(size, '.'));
+		for (std::string& row : grid)
+		{
+			std::ranges::generate(row, [&random, letters]() { return letters[random_int(random, 0, 3)]; });
+		}
+		return to_string(grid);
+	}
+
+	// Like the real input: every pair of pages has a rule, so every update has exactly one right order.
+	// Page numbers have two digits, as the solution stores them in an int8_t.
+	std::string generate_day_5(int scale, Random& random)
+	{
+		constexpr int num_pages = 49;
+		std::vector<int> pages;
+		for (int page = 10; page <= 99; ++page) pages.push_back(page);
+		random_shuffle(pages, random);
+		pages.resize(num_pages);
+
+		// pages[i] comes before pages[j] whenever i < j.
+		std::vector<std::pair<int, int>> rules;
+		for (int i = 0; i < num_pages; ++i)
+		{
+			for (int j = i + 1; j < num_pages; ++j) rules.emplace_back(pages[i], pages[j]);
+		}
+		random_shuffle(rules, random);
+		std::string result;
+		for (const auto& [before, after] : rules)
+		{
+			result.append(std::format("{}|{}\n", before, after));
+		}
+		result.push_back('\n');
+
+		const int num_updates = 200 * scale;
+		std::vector<int> page_indices(num_pages);
+		for (int i = 0; i < num_pages; ++i) page_indices[i] = i;
+		for (int i = 0; i < num_updates; ++i)
+		{
+			const int length = 2 * random_int(random, 2, 11) + 1; // There has to be a middle page.
+			random_shuffle(page_indices, random);
+			std::vector<int> update{ begin(page_indices), begin(page_indices) + length };
+			if (random_chance(random, 50))
+			{
+				std::ranges::sort(update);
+			}
+			for (int j = 0; j < length; ++j)
+			{
+				if (j > 0) result.push_back(',');
+				result.append(std::to_string(pages[update[j]]));
+			}
+			result.push_back('\n');
+		}
+		return result;
+	}
+
+	// The guard has to walk off the grid, so keep making grids until it does.
+	bool guard_leaves(const Grid& grid, int x, int y)
+	{
+		const int size = static_cast<int>(grid.size());
+		std::vector<uint8_t> seen(grid.size() * grid.size(), 0u);
+		int dir = 0;
+		while (true)
+		{
+			uint8_t& seen_dirs = seen[y * size + x];
+			if (seen_dirs & (1u << dir)) return false;
+			seen_dirs |= (1u << dir);
+			const int nx = x + directions[dir].first;
+			const int ny = y + directions[dir].second;
+			if (!in_grid(nx, ny, size, size)) return true;
+			if (grid[ny][nx] == '#')
+			{
+				dir = (dir + 1) % 4;
+				continue;
+			}
+			x = nx;
+			y = ny;
+		}
+	}
+
+	std::string generate_day_6(int scale, Random& random)
+	{
+		const int size = 130 * scale;
+		while (true)
+		{
+			Grid grid(size, std::string(size, '.'));
+			for (std::string& row : grid)
+			{
+				std::ranges::generate(row, [&random]() { return random_chance(random, 3) ? '#' : '.'; });
+			}
+			const int x = random_int(random, size / 4, 3 * size / 4);
+			const int y = random_int(random, size / 4, 3 * size / 4);
+			grid[y][x] = '.';
+			if (guard_leaves(grid, x, y))
+			{
+				grid[y][x] = '^';
+				return to_string(grid);
+			}
+		}
+	}
+
+	// Half the equations can be made true, some of them only with concatenation. The rest are one out, which is
+	// usually enough to make them impossible. Values are built up left to right until the next one could overflow.
+	std::string generate_day_7(int scale, Random& random)
+	{
+		constexpr int64_t max_target = 1'000'000'000'000'000;
+		const int num_equations = 850 * scale;
+		std::string result;
+		for (int i = 0; i < num_equations; ++i)
+		{
+			std::vector<int> values(random_int(random, 2, 12));
+			std::ranges::generate(values, [&random]() { return random_chance(random, 80) ? random_int(random, 1, 99) : random_int(random, 100, 999); });
+			int64_t target = values.front();
+			for (std::size_t j = 1u; j < values.size(); ++j)
+			{
+				const int64_t value = values[j];
+				const int64_t concat_multiplier = value < 10 ? 10 : value < 100 ? 100 : 1000;
+				if (target > max_target / concat_multiplier)
+				{
+					values.resize(j);
+					break;
+				}
+				switch (random_int(random, 0, 2))
+				{
+				case 0: target += value; break;
+				case 1: target *= value; break;
+				default: target = target * concat_multiplier + value; break;
+				}
+			}
+			if (random_chance(random, 50))
+			{
+				++target;
+			}
+
+			result.append(std::format("{}:", target));
+			for (int value : values)
+			{
+				result.append(std::format(" {}", value));
+			}
+			result.push_back('\n');
+		}
+		return result;
+	}
+
+	// The solution stores coordinates in an int8_t and antinodes can land a whole grid away from an antenna, so the
+	// roof can't be more than 64 wide. Beyond that, bigger scales put more antennas on it instead.
+	std::string generate_day_8(int scale, Random& random)
+	{
+		constexpr std::string_view frequencies = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+		const int size = std::min(50 * scale, 64);
+		const int num_antennas = std::min(160 * scale, size * size / 2);
+		Grid grid(size, std::string(size, '.'));
+		for (int i = 0; i < num_antennas; ++i)
+		{
+			char* cell = nullptr;
+			do
+			{
+				cell = &grid[random_int(random, 0, size - 1)][random_int(random, 0, size - 1)];
+			} while (*cell != '.');
+			*cell = frequencies[random_int(random, 0, static_cast<int>(frequencies.size()) - 1)];
+		}
+		return to_string(grid);
+	}
+
+	std::string generate_day_9(int scale, Random& random)
+	{
+		const int length = 20000 * scale - 1;
+		std::string result(length, '0');
+		for (int i = 0; i < length; ++i)
+		{
+			const bool is_file = (i % 2) == 0;
+			result[i] = static_cast<char>('0' + random_int(random, is_file ? 1 : 0, 9));
+		}
+		result.push_back('\n');
+		return result;
+	}
+
+	// Diagonal slopes with some noise, so there are plenty of trails without every cell being on one.
+	std::string generate_day_10(int scale, Random& random)
+	{
+		const int size = 50 * scale;
+		Grid grid(size, std::string(size, '.'));
+		for (int y = 0; y < size; ++y)
+		{
+			for (int x = 0; x < size; ++x)
+			{
+				const int height = random_chance(random, 20) ? random_int(random, 0, 9) : (x + y) % 10;
+				grid[y][x] = static_cast<char>('0' + height);
+			}
+		}
+		return to_string(grid);
+	}
+
+	std::string generate_day_11(int scale, Random& random)
+	{
+		const int num_stones = 8 * scale;
+		std::string result;
+		for (int i = 0; i < num_stones; ++i)
+		{
+			if (i > 0) result.push_back(' ');
+			result.append(std::to_string(random_int(random, 0, 9'999'999)));
+		}
+		result.push_back('\n');
+		return result;
+	}
+
+	// Blocks of one plant with ragged edges, which leaves small islands of plants from the neighbouring blocks.
+	std::string generate_day_12(int scale, Random& random)
+	{
+		const int size = 140 * scale;
+		constexpr int block_size = 6;
+		const int num_blocks = size / block_size + 2;
+		std::vector<char> blocks(num_blocks * num_blocks);
+		std::ranges::generate(blocks, [&random]() { return static_cast<char>('A' + random_int(random, 0, 25)); });
+
+		Grid grid(size, std::string(size, '.'));
+		for (int y = 0; y < size; ++y)
+		{
+			for (int x = 0; x < size; ++x)
+			{
+				const int jittered_x = std::clamp(x + random_int(random, -2, 2), 0, size - 1);
+				const int jittered_y = std::clamp(y + random_int(random, -2, 2), 0, size - 1);
+				grid[y][x] = blocks[(jittered_y / block_size) * num_blocks + jittered_x / block_size];
+			}
+		}
+		return to_string(grid);
+	}
+
+	// Whether a claw machine's prize can be reached with a whole number of presses of each button. The solution
+	// treats a whole number that is out of range as a broken input, so the generator has to avoid those.
+	bool is_claw_machine_valid(int64_t ax, int64_t ay, int64_t bx, int64_t by, int64_t px, int64_t py, int64_t max_presses)
+	{
+		const int64_t m = ay * bx - ax * by;
+		if (m == 0) return false;
+		const int64_t n = bx * py - by * px;
+		if (n % m != 0) return true;
+		const int64_t a = n / m;
+		if ((px - a * ax) % bx != 0) return true;
+		const int64_t b = (px - a * ax) / bx;
+		return 0 <= a && a <= max_presses && 0 <= b && b <= max_presses;
+	}
+
+	// About a third of the prizes are reachable in part one, and about a third in part two, where every prize is
+	// moved a long way off. Those get their presses worked out backwards from a point near the moved prize.
+	std::string generate_day_13(int scale, Random& random)
+	{
+		constexpr int64_t part_two_offset = 10'000'000'000'000;
+		const int num_machines = 320 * scale;
+		std::string result;
+		for (int i = 0; i < num_machines;)
+		{
+			const int ax = random_int(random, 10, 99);
+			const int ay = random_int(random, 10, 99);
+			const int bx = random_int(random, 10, 99);
+			const int by = random_int(random, 10, 99);
+			int64_t px = random_int(random, 1000, 20000);
+			int64_t py = random_int(random, 1000, 20000);
+			switch (random_int(random, 0, 2))
+			{
+			case 0:
+			{
+				const int a = random_int(random, 0, 100);
+				const int b = random_int(random, 0, 100);
+				px = a * ax + b * bx;
+				py = a * ay + b * by;
+				break;
+			}
+			case 1:
+			{
+				const double determinant = static_cast<double>(ax * by - ay * bx);
+				if (determinant == 0.0) continue;
+				const double target_x = static_cast<double>(part_two_offset + px);
+				const double target_y = static_cast<double>(part_two_offset + py);
+				const int64_t a = std::llround((target_x * by - target_y * bx) / determinant);
+				const int64_t b = std::llround((target_y * ax - target_x * ay) / determinant);
+				px = a * ax + b * bx - part_two_offset;
+				py = a * ay + b * by - part_two_offset;
+				if (a < 0 || b < 0 || px < 0 || py < 0) continue;
+				break;
+			}
+			default:
+				break;
+			}
+			if (!is_claw_machine_valid(ax, ay, bx, by, px, py, 100)) continue;
+			if (!is_claw_machine_valid(ax, ay, bx, by, px + part_two_offset, py + part_two_offset, std::numeric_limits<int64_t>::max())) continue;
+
+			if (i > 0) result.push_back('\n');
+			result.append(std::format("Button A: X+{}, Y+{}\nButton B: X+{}, Y+{}\nPrize: X={}, Y={}\n", ax, ay, bx, by, px, py));
+			++i;
+		}
+		return result;
+	}
+
+	// Some of the robots meet in a box at one step, so part two has an answer to find.
+	std::string generate_day_14(int scale, Random& random)
+	{
+		constexpr int width = 101;
+		constexpr int height = 103;
+		const int num_robots = 500 * scale;
+		const int meeting_step = random_int(random, 0, width * height - 1);
+		std::string result;
+		for (int i = 0; i < num_robots; ++i)
+		{
+			const int vx = random_int(random, -100, 100);
+			const int vy = random_int(random, -100, 100);
+			int px = random_int(random, 0, width - 1);
+			int py = random_int(random, 0, height - 1);
+			if (random_chance(random, 30))
+			{
+				const int target_x = random_int(random, 35, 65);
+				const int target_y = random_int(random, 35, 67);
+				px = static_cast<int>(((target_x - static_cast<int64_t>(vx) * meeting_step) % width + width) % width);
+				py = static_cast<int>(((target_y - static_cast<int64_t>(vy) * meeting_step) % height + height) % height);
+			}
+			result.append(std::format("p={},{} v={},{}\n", px, py, vx, vy));
+		}
+		return result;
+	}
+
+	std::string generate_day_15(int scale, Random& random)
+	{
+		const int size = 50 * scale;
+		Grid grid(size, std::string(size, '#'));
+		for (int y = 1; y < size - 1; ++y)
+		{
+			for (int x = 1; x < size - 1; ++x)
+			{
+				const int roll = random_int(random, 0, 99);
+				grid[y][x] = roll < 8 ? '#' : roll < 38 ? 'O' : '.';
+			}
+		}
+		grid[size / 2][size / 2] = '@';
+
+		constexpr std::string_view moves = "<>^v";
+		constexpr int line_length = 1000;
+		const int num_moves = 20000 * scale;
+		std::string result = to_string(grid);
+		result.push_back('\n');
+		for (int i = 0; i < num_moves; ++i)
+		{
+			result.push_back(moves[random_int(random, 0, 3)]);
+			if ((i + 1) % line_length == 0 || i + 1 == num_moves)
+			{
+				result.push_back('\n');
+			}
+		}
+		return result;
+	}
+
+	// A maze with some walls knocked out, so there are many routes and several best ones.
+	std::string generate_day_16(int scale, Random& random)
+	{
+		const int size = (141 * scale) | 1; // Mazes need an odd size.
+		Grid grid(size, std::string(size, '#'));
+		carve_maze(grid, random);
+		for (int y = 1; y < size - 1; ++y)
+		{
+			for (int x = 1; x < size - 1; ++x)
+			{
+				const bool between_cells = ((x + y) % 2) == 1;
+				if (between_cells && grid[y][x] == '#' && random_chance(random, 10))
+				{
+					grid[y][x] = '.';
+				}
+			}
+		}
+		grid[size - 2][1] = 'S';
+		grid[1][size - 2] = 'E';
+		return to_string(grid);
+	}
+
+	bool can_reach_exit(const std::vector<uint8_t>& blocked, int size)
+	{
+		std::vector<uint8_t> seen(blocked.size(), 0u);
+		std::vector<int> to_visit{ 0 };
+		seen[0] = 1u;
+		while (!to_visit.empty())
+		{
+			const int cell = to_visit.back();
+			to_visit.pop_back();
+			if (cell == size * size - 1) return true;
+			for (const auto& [dx, dy] : directions)
+			{
+				const int nx = cell % size + dx;
+				const int ny = cell / size + dy;
+				const int next = ny * size + nx;
+				if (in_grid(nx, ny, size, size) && !blocked[next] && !seen[next])
+				{
+					seen[next] = 1u;
+					to_visit.push_back(next);
+				}
+			}
+		}
+		return false;
+	}
+
+	// The first 1024 bytes must leave a way through for part one, and all of them must block it for part two.
+	std::string generate_day_18(int scale, Random& random)
+	{
+		const int size = 71 * scale;
+		constexpr int num_part_one_bytes = 1024;
+		std::vector<int> cells;
+		cells.reserve(size * size);
+		for (int cell = 1; cell < size * size - 1; ++cell)
+		{
+			cells.push_back(cell);
+		}
+
+		while (true)
+		{
+			random_shuffle(cells, random);
+			const std::size_t num_bytes = cells.size() * 68u / 100u;
+			std::vector<uint8_t> blocked(size * size, 0u);
+			auto block = [&blocked, &cells](std::size_t first, std::size_t last)
+				{
+					for (std::size_t i = first; i < last; ++i) blocked[cells[i]] = 1u;
+				};
+
+			block(0u, num_part_one_bytes);
+			if (!can_reach_exit(blocked, size)) continue;
+			block(num_part_one_bytes, num_bytes);
+			if (can_reach_exit(blocked, size)) continue;
+
+			std::string result;
+			for (std::size_t i = 0u; i < num_bytes; ++i)
+			{
+				result.append(std::format("{},{}\n", cells[i] % size, cells[i] / size));
+			}
+			return result;
+		}
+	}
+
+	// Like the real input: a few hundred towels, with one of the five single stripe towels missing so that not every
+	// design can be made. Designs with so many arrangements that adding them all up could overflow are skipped.
+	std::string generate_day_19(int scale, Random& random)
+	{
+		constexpr std::string_view colors = "wubrg";
+		constexpr std::size_t num_towels = 447u;
+		constexpr int64_t max_arrangements = 10'000'000'000'000;
+		auto random_color = [&random, colors]() { return colors[random_int(random, 0, static_cast<int>(colors.size()) - 1)]; };
+
+		std::set<std::string> towels;
+		const char missing_color = random_color();
+		for (char color : colors)
+		{
+			if (color != missing_color) towels.insert(std::string(1u, color));
+		}
+		while (towels.size() < num_towels)
+		{
+			std::string towel(random_int(random, 2, 8), ' ');
+			std::ranges::generate(towel, random_color);
+			towels.insert(std::move(towel));
+		}
+		std::vector<std::string> towel_list{ begin(towels), end(towels) };
+		random_shuffle(towel_list, random);
+
+		std::string result;
+		for (const std::string& towel : towel_list)
+		{
+			if (!result.empty()) result.append(", ");
+			result.append(towel);
+		}
+		result.append("\n\n");
+
+		auto count_arrangements = [&towels](const std::string& design)
+			{
+				std::vector<int64_t> ways(design.size() + 1u, 0);
+				ways[design.size()] = 1;
+				for (std::size_t start = design.size(); start-- > 0u;)
+				{
+					for (std::size_t length = 1u; length <= 8u && start + length <= design.size(); ++length)
+					{
+						if (towels.contains(design.substr(start, length)))
+						{
+							ways[start] = std::min(ways[start] + ways[start + length], max_arrangements + 1);
+						}
+					}
+				}
+				return ways.front();
+			};
+
+		const int num_designs = 400 * scale;
+		for (int i = 0; i < num_designs;)
+		{
+			const std::size_t length = static_cast<std::size_t>(random_int(random, 40, 60));
+			std::string design;
+			if (random_chance(random, 60))
+			{
+				while (design.size() < length)
+				{
+					design.append(towel_list[random_int(random, 0, static_cast<int>(towel_list.size()) - 1)]);
+				}
+			}
+			else
+			{
+				design.resize(length);
+				std::ranges::generate(design, random_color);
+			}
+			if (count_arrangements(design) > max_arrangements) continue;
+			result.append(design);
+			result.push_back('\n');
+			++i;
+		}
+		return result;
+	}
+
+	// A single track with no branches: the route through a maze from one corner to the cell furthest from it.
+	std::string generate_day_20(int scale, Random& random)
+	{
+		const int size = (141 * scale) | 1; // Mazes need an odd size.
+		Grid maze(size, std::string(size, '#'));
+		const Maze tree = carve_maze(maze, random);
+		const auto end_it = std::ranges::max_element(tree.depths);
+		int cell = static_cast<int>(std::distance(begin(tree.depths), end_it));
+
+		Grid grid(size, std::string(size, '#'));
+		auto cell_tile = [&grid, &tree](int c) -> char& { return grid[2 * (c / tree.num_cells) + 1][2 * (c % tree.num_cells) + 1]; };
+		cell_tile(cell) = 'E';
+		while (tree.parents[cell] >= 0)
+		{
+			const int parent = tree.parents[cell];
+			const int n = tree.num_cells;
+			grid[cell / n + parent / n + 1][cell % n + parent % n + 1] = '.';
+			cell = parent;
+			if (tree.parents[cell] >= 0) cell_tile(cell) = '.';
+		}
+		cell_tile(cell) = 'S';
+		return to_string(grid);
+	}
+
+	std::string generate_day_22(int scale, Random& random)
+	{
+		const int num_merchants = 2000 * scale;
+		std::string result;
+		for (int i = 0; i < num_merchants; ++i)
+		{
+			result.append(std::format("{}\n", random_int(random, 1, (1 << 24) - 1)));
+		}
+		return result;
+	}
+
+	// Like the real input: every computer has 13 connections, and there is one LAN party of 13 computers.
+	std::string generate_day_23(int scale, Random& random)
+	{
+		constexpr int num_names = 26 * 26;
+		constexpr int num_connections = 13;
+		const int num_computers = std::min(520 * scale, num_names);
+
+		std::vector<int> names(num_names);
+		for (int i = 0; i < num_names; ++i) names[i] = i;
+		random_shuffle(names, random);
+		names.resize(num_computers);
+
+		std::set<std::pair<int, int>> links;
+		std::vector<int> num_links(num_computers, 0);
+		auto link = [&links, &num_links](int a, int b)
+			{
+				if (a == b || !links.insert(std::minmax(a, b)).second) return;
+				++num_links[a];
+				++num_links[b];
+			};
+
+		for (int a = 0; a < num_connections; ++a)
+		{
+			for (int b = a + 1; b < num_connections; ++b) link(a, b);
+		}
+
+		for (int a = 0; a < num_computers; ++a)
+		{
+			for (int attempt = 0; attempt < 100 && num_links[a] < num_connections; ++attempt)
+			{
+				const int b = random_int(random, num_connections, num_computers - 1);
+				if (num_links[b] < num_connections) link(a, b);
+			}
+		}
+
+		std::vector<std::pair<int, int>> shuffled_links{ begin(links), end(links) };
+		random_shuffle(shuffled_links, random);
+		auto name = [&names](int computer)
+			{
+				return std::string{ static_cast<char>('a' + names[computer] / 26), static_cast<char>('a' + names[computer] % 26) };
+			};
+
+		std::string result;
+		for (auto [a, b] : shuffled_links)
+		{
+			result.append(std::format("{}-{}\n", name(a), name(b)));
+		}
+		return result;
+	}
+
+	using generator_func = std::string(*)(int, Random&);
+
+	struct input_generator
+	{
+		int day;
+		generator_func generate;
+	};
+
+	constexpr std::array input_generators
+	{
+		input_generator{ 1, generate_day_1 },
+		input_generator{ 2, generate_day_2 },
+		input_generator{ 3, generate_day_3 },
+		input_generator{ 4, generate_day_4 },
+		input_generator{ 5, generate_day_5 },
+		input_generator{ 6, generate_day_6 },
+		input_generator{ 7, generate_day_7 },
+		input_generator{ 8, generate_day_8 },
+		input_generator{ 9, generate_day_9 },
+		input_generator{ 10, generate_day_10 },
+		input_generator{ 11, generate_day_11 },
+		input_generator{ 12, generate_day_12 },
+		input_generator{ 13, generate_day_13 },
+		input_generator{ 14, generate_day_14 },
+		input_generator{ 15, generate_day_15 },
+		input_generator{ 16, generate_day_16 },
+		input_generator{ 18, generate_day_18 },
+		input_generator{ 19, generate_day_19 },
+		input_generator{ 20, generate_day_20 },
+		input_generator{ 22, generate_day_22 },
+		input_generator{ 23, generate_day_23 },
+	};
+
+	struct missing_generator
+	{
+		int day;
+		std::string_view reason;
+	};
+
+	constexpr std::array missing_generators
+	{
+		missing_generator{ 17, "The input is one short program and its registers. Nothing in it can grow: the registers are 64 bits, which keeps the output short. Part two isn't solved yet either." },
+		missing_generator{ 21, "Day 21 isn't solved yet." },
+		missing_generator{ 24, "Part two isn't solved yet, and part one reads the z wires into a 64 bit number, so the adder can't grow." },
+		missing_generator{ 25, "Day 25 isn't solved yet." },
+	};
+}
+
+bool advent::can_generate_input(int day)
+{
+	return std::ranges::find(input_generators, day, &input_generator::day) != end(input_generators);
+}
+
+std::string_view advent::get_missing_generator_reason(int day)
+{
+	if (can_generate_input(day)) return {};
+	const auto missing_it = std::ranges::find(missing_generators, day, &missing_generator::day);
+	if (missing_it != end(missing_generators)) return missing_it->reason;
+	return "There is no puzzle for that day.";
+}
+
+std::string advent::generate_input(int day, int scale, uint64_t seed)
+{
+	const auto generator_it = std::ranges::find(input_generators, day, &input_generator::day);
+	AdventCheckMsg(generator_it != end(input_generators), "No input generator for day ", day, ": ", get_missing_generator_reason(day));
+	AdventCheckMsg(scale >= 1, "Scale must be at least 1, not ", scale);
+	Random random{ seed };
+	std::string result = generator_it->generate(scale, random);
+	// Puzzle inputs don't end in a newline, and some solutions read one as an extra, empty line.
+	if (result.ends_with('\n'))
+	{
+		result.pop_back();
+	}
+	return result;
+}
\ No newline at end of file
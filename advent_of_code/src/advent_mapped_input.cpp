@@ -0,0 +1,117 @@
+#include "advent/advent_mapped_input.h"
+#include "advent/advent_assert.h"
+#include "advent/advent_utils.h"
+
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+advent::mapped_input::mapped_input(const std::string& filename)
+{
+	const HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	AdventCheckMsg(file != INVALID_HANDLE_VALUE, "Could not open '", filename, '\'');
+
+	LARGE_INTEGER file_size;
+	const bool got_size = GetFileSizeEx(file, &file_size) != FALSE;
+	if (!got_size || file_size.QuadPart == 0)
+	{
+		// Empty files cannot be mapped, so leave them as an empty view.
+		CloseHandle(file);
+		AdventCheckMsg(got_size, "Could not get size of '", filename, '\'');
+		return;
+	}
+
+	// The view keeps the mapping alive, so both handles can be closed straight away.
+	const HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(file);
+	AdventCheckMsg(mapping != nullptr, "Could not map '", filename, '\'');
+	const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	AdventCheckMsg(data != nullptr, "Could not map '", filename, '\'');
+
+	m_data = static_cast<const char*>(data);
+	m_size = static_cast<std::size_t>(file_size.QuadPart);
+}
+
+void advent::mapped_input::release() noexcept
+{
+	if (m_data != nullptr)
+	{
+		UnmapViewOfFile(m_data);
+	}
+	m_data = nullptr;
+	m_size = 0u;
+}
+#else
+advent::mapped_input::mapped_input(const std::string& filename)
+{
+	const int file = open(filename.c_str(), O_RDONLY);
+	AdventCheckMsg(file >= 0, "Could not open '", filename, '\'');
+
+	struct stat file_stats;
+	const bool got_size = fstat(file, &file_stats) == 0;
+	if (!got_size || file_stats.st_size == 0)
+	{
+		// Empty files cannot be mapped, so leave them as an empty view.
+		close(file);
+		AdventCheckMsg(got_size, "Could not get size of '", filename, '\'');
+		return;
+	}
+
+	// The mapping stays valid after the file is closed.
+	const std::size_t size = static_cast<std::size_t>(file_stats.st_size);
+	void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+	close(file);
+	AdventCheckMsg(data != MAP_FAILED, "Could not map '", filename, '\'');
+	madvise(data, size, MADV_SEQUENTIAL);
+
+	m_data = static_cast<const char*>(data);
+	m_size = size;
+}
+
+void advent::mapped_input::release() noexcept
+{
+	if (m_data != nullptr)
+	{
+		munmap(const_cast<char*>(m_data), m_size);
+	}
+	m_data = nullptr;
+	m_size = 0u;
+}
+#endif
+
+advent::mapped_input::mapped_input(mapped_input&& other) noexcept
+	: m_data{ std::exchange(other.m_data, nullptr) }, m_size{ std::exchange(other.m_size, 0u) }
+{
+}
+
+advent::mapped_input& advent::mapped_input::operator=(mapped_input&& other) noexcept
+{
+	if (this != &other)
+	{
+		release();
+		m_data = std::exchange(other.m_data, nullptr);
+		m_size = std::exchange(other.m_size, 0u);
+	}
+	return *this;
+}
+
+advent::mapped_input::~mapped_input()
+{
+	release();
+}
+
+advent::mapped_input advent::open_mapped_puzzle_input(int day)
+{
+	return mapped_input{ get_puzzle_input_name(day) };
+}
\ No newline at end of file
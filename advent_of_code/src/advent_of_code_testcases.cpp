@@ -9,268 +9,456 @@
 #include <iomanip>
 #include <cassert>
 #include <numeric>
+#include <mutex>
+#include <span>
+#include <cmath>
+#include <fstream>
+#include <filesystem>
+#include <atomic>
 
 #include "advent/advent_of_code.h"
 #include "advent/advent_headers.h"
 #include "advent/advent_setup.h"
 #include "advent/advent_assert.h"
+#include "advent/advent_utils.h"
+#include "advent/advent_platform.h"
+#include "advent/advent_allocations.h"
+#include "advent/advent_trace.h"
+#include "advent/advent_cancellation.h"
+#include "advent/advent_mapped_input.h"
+#include "advent/advent_view_solvers.h"
+#include "advent/advent_test_result.h"
+#include "advent/advent_results_io.h"
+#include "advent/advent_benchmark.h"
 
 #include "utils/tests/utils_tests.h"
+#include "utils/thread_pool.h"
 
-namespace
+std::string to_string(const std::optional<std::string>& os)
+{
+	return os.value_or("");
+}
+
+template <test_status status>
+bool check_result(const test_result& result)
+{
+	return status == result.status;
+}
+
+ResultType test_execute_wrapper(const verification_test& test)
 {
-	struct ResultStringifier
+	try
 	{
-		std::string operator()(const std::string& in) const noexcept { return in; }
-		template <std::integral T>
-		std::string operator()(T in) const { return std::to_string(in); }
-	};
+#ifdef NDEBUG
+		return test.execute();
+#else
+		try
+		{
+			return test.execute();
+		}
+		catch (const advent::test_failed& tf)
+		{
+			return std::string{ "ERROR: " } + std::string{ tf.what() };
+		}
+#endif
+	}
+	catch (const advent::test_cancelled&)
+	{
+		return std::string{ "TIMEOUT" };
+	}
 }
 
-std::string to_string(const ResultType& rt)
+std::pair<ResultType,std::chrono::nanoseconds> run_test_func(const verification_test& test)
 {
-	return std::visit(ResultStringifier{}, rt);
+	return time_function([&test]() { return test_execute_wrapper(test); });
 }
 
-std::string to_string(const std::optional<std::string>& os)
+std::pair<ResultType, benchmark_stats> run_benchmark(const verification_test& test, std::size_t num_warmups, std::size_t num_repetitions)
 {
-	return os.value_or("");
+	return benchmark_function([&test]() { return test_execute_wrapper(test); }, num_warmups, num_repetitions);
 }
 
-// Result a test can give.
-enum class test_status : char
+advent::watchdog& get_test_watchdog()
 {
-	pass,
-	fail,
-	unknown,
-	filtered
-};
+	static advent::watchdog test_watchdog;
+	return test_watchdog;
+}
 
-// Full results of a test.
-struct test_result
+// Everything measured while running one test, before it is checked against the expected result.
+struct test_measurement
 {
-	std::string name;
 	std::string result;
-	std::string expected;
-	test_status status = test_status::unknown;
 	std::chrono::nanoseconds time_taken{};
+	std::optional<benchmark_stats> stats;
+	std::vector<test_counter> counters;
+	bool timed_out = false;
 };
 
-template <test_status status>
-bool check_result(const test_result& result)
+test_measurement measure_test(const verification_test& test, const verification_options& options)
 {
-	return status == result.status;
+	ResultType res;
+	test_measurement measurement;
+	std::atomic_bool timed_out{ false };
+	{
+		const advent::cancellation_scope cancellation{ advent::cancellation_token{ &timed_out } };
+		std::optional<advent::watchdog::watch> timeout_watch;
+		if (options.timeout > std::chrono::milliseconds{ 0 })
+		{
+			timeout_watch.emplace(get_test_watchdog(), timed_out, options.timeout);
+		}
+		benchmark_counters test_counters{ options.track_allocations, options.hardware_counters };
+		if (options.benchmark)
+		{
+			std::tie(res, measurement.stats) = run_benchmark(test, options.benchmark_warmups, options.benchmark_repetitions);
+			measurement.time_taken = measurement.stats->median;
+		}
+		else
+		{
+			std::tie(res, measurement.time_taken) = run_test_func(test);
+		}
+		// In benchmark mode, report the average over every run (including warmups).
+		const std::size_t num_runs = options.benchmark ? options.benchmark_warmups + options.benchmark_repetitions : 1u;
+		measurement.counters = test_counters.stop(num_runs);
+	}
+	measurement.result = to_string(res);
+	measurement.timed_out = timed_out;
+	return measurement;
 }
 
-std::string two_digits(int num)
+// The child process in isolation mode sends its measurement back as text. The result goes last, because
+// it may contain spaces and newlines.
+std::string serialise_measurement(const test_measurement& measurement)
 {
 	std::ostringstream oss;
-	oss << std::setfill('0') << std::setw(2) << num;
+	oss << measurement.timed_out << ' ' << measurement.time_taken.count() << ' ' << measurement.stats.has_value();
+	if (measurement.stats.has_value())
+	{
+		const benchmark_stats& stats = *measurement.stats;
+		oss << ' ' << stats.num_samples << ' ' << stats.min.count() << ' ' << stats.median.count() << ' ' << stats.mean.count()
+			<< ' ' << stats.p90.count() << ' ' << stats.p99.count() << ' ' << stats.stddev.count();
+	}
+	oss << ' ' << measurement.counters.size();
+	for (const test_counter& counter : measurement.counters)
+	{
+		oss << ' ' << counter.name << ' ' << counter.value;
+	}
+	oss << '\n' << measurement.result;
 	return oss.str();
 }
 
-std::optional<std::string> to_human_readable(long long count, int inner_max, int outer_max, const std::string& suffix)
+std::optional<test_measurement> parse_measurement(const std::string& text)
 {
-	if (count < inner_max)
-		return std::to_string(count) + suffix;
-
-	if (count < (static_cast<decltype(count)>(inner_max) * static_cast<decltype(count)>(outer_max)))
+	std::istringstream iss{ text };
+	test_measurement measurement;
+	auto read_duration = [&iss](std::chrono::nanoseconds& out)
+		{
+			int64_t count = 0;
+			iss >> count;
+			out = std::chrono::nanoseconds{ count };
+		};
+	bool has_stats = false;
+	iss >> measurement.timed_out;
+	read_duration(measurement.time_taken);
+	iss >> has_stats;
+	if (has_stats)
 	{
-		std::ostringstream oss;
-		oss << count / inner_max << ':' << two_digits(count % inner_max) << suffix;
-		return oss.str();
+		benchmark_stats& stats = measurement.stats.emplace();
+		iss >> stats.num_samples;
+		for (std::chrono::nanoseconds* field : { &stats.min, &stats.median, &stats.mean, &stats.p90, &stats.p99, &stats.stddev })
+		{
+			read_duration(*field);
+		}
 	}
-
-	return std::optional<std::string>{};
+	std::size_t num_counters = 0u;
+	iss >> num_counters;
+	for (std::size_t i = 0u; i < num_counters && iss; ++i)
+	{
+		test_counter& counter = measurement.counters.emplace_back();
+		iss >> counter.name >> counter.value;
+	}
+	if (!iss || iss.get() != '\n') return std::nullopt;
+	measurement.result.assign(std::istreambuf_iterator<char>{ iss }, std::istreambuf_iterator<char>{});
+	return measurement;
 }
 
-std::string to_human_readable(std::chrono::hours time)
+// Runs the test in a forked child, so its peak memory and page faults can be measured on their own.
+test_measurement measure_test_in_child_process(const verification_test& test, const verification_options& options)
 {
-	const auto count = time.count();
-	std::ostringstream oss;
-	oss << count / 24 << " days and " << count % 24 << " hours";
-	return oss.str();
+	const advent::platform::child_process_result child = advent::platform::run_in_child_process([&test, &options]()
+		{
+			return serialise_measurement(measure_test(test, options));
+		});
+	std::optional<test_measurement> measurement = child.completed ? parse_measurement(child.output) : std::nullopt;
+	if (!measurement.has_value())
+	{
+		measurement.emplace();
+		measurement->result = "CRASHED";
+	}
+	measurement->counters.push_back(test_counter{ "max_rss_bytes", child.max_rss_bytes });
+	measurement->counters.push_back(test_counter{ "major_page_faults", child.major_page_faults });
+	measurement->counters.push_back(test_counter{ "minor_page_faults", child.minor_page_faults });
+	return *measurement;
 }
 
-std::string to_human_readable(std::chrono::minutes time)
+test_result run_test(const verification_test& test, const verification_options& options)
 {
-	const auto res = to_human_readable(time.count(), 60, 24, "s");
-	if (res.has_value())
-		return res.value();
+	static std::mutex output_mutex;
+	{
+		std::scoped_lock lock{ output_mutex };
+		std::cout << "Running test " << test.name << "...";
+	}
+	test_measurement measurement;
+	{
+		// Test names are always string literals, so they are null terminated.
+		const advent::trace::scope trace_scope{ test.name.data() };
+		measurement = options.isolate ? measure_test_in_child_process(test, options) : measure_test(test, options);
+	}
+	const std::string& string_result = measurement.result;
+	const std::chrono::nanoseconds time_taken = measurement.time_taken;
+	const std::optional<benchmark_stats>& stats = measurement.stats;
+	{
+		std::scoped_lock lock{ output_mutex };
+		std::cout << "\nFinished " << test.name << ": took " << (stats.has_value() ? to_string(*stats) : to_human_readable(time_taken)) << " and got " << string_result << '\n';
+	}
+	const std::optional<std::string> expected_result = test.get_expected_result();
+	auto get_result = [&](test_status status)
+	{
+		return test_result{ std::string{ test.name },string_result,to_string(expected_result),status,time_taken,stats,measurement.counters };
+	};
 
-	const auto h = std::chrono::duration_cast<std::chrono::hours>(time);
-	return to_human_readable(h);
+	if (measurement.timed_out)
+	{
+		return get_result(test_status::timeout);
+	}
+	if(!expected_result.has_value())
+	{
+		return get_result(test_status::unknown);
+	}
+	else
+	{
+		return get_result(string_result == *expected_result ? test_status::pass : test_status::fail);
+	}
 }
 
-std::string to_human_readable(std::chrono::seconds time)
+// Tests with a higher priority are started first when running in parallel, so the slowest
+// ones don't end up being the last thing left running.
+int get_schedule_priority(const verification_test& test)
 {
-	const auto res = to_human_readable(time.count(), 60,60,"s");
-	if (res.has_value())
-		return res.value();
-
-	const auto m = std::chrono::duration_cast<std::chrono::minutes>(time);
-	return to_human_readable(m);
+	const auto long_running_it = std::ranges::find(long_running_tests, test.name);
+	if (long_running_it != end(long_running_tests))
+	{
+		return 2 + static_cast<int>(std::distance(long_running_it, end(long_running_tests)));
+	}
+	return test.name.starts_with("advent_") ? 1 : 0;
 }
 
-std::optional<std::string> to_human_readable(long long count, const std::string& suffix_short, const std::string& suffix_long)
+// Filtering only looks at the names in the table, so tests which are filtered out never allocate anything.
+void select_tests(std::span<const verification_test> all_tests, const std::vector<std::string_view>& filters, std::vector<const verification_test*>& selected)
 {
-	if (count < 10'000)
-		return std::to_string(count) + suffix_short;
-	if (count < 100'000)
+	auto matches_filter = [&filters](const verification_test& test)
+		{
+			return filters.empty() || std::ranges::any_of(filters, [&test](std::string_view filter_item)
+				{
+					return test.name.find(filter_item) != test.name.npos;
+				});
+		};
+	for (const verification_test& test : all_tests)
 	{
-		std::ostringstream oss;
-		oss << std::setprecision(3) << static_cast<double>(count) / 1000.0 << suffix_long;
-		return oss.str();
+		if (matches_filter(test))
+		{
+			selected.push_back(&test);
+		}
 	}
-	return std::optional<std::string>{};
 }
 
-std::string to_human_readable(std::chrono::milliseconds time)
+void run_tests(std::span<const verification_test* const> tests_to_run, std::span<test_result> results, const verification_options& options)
 {
-	const auto res = to_human_readable(time.count(), "ms", "s");
-	if (res.has_value())
-		return res.value();
-
-	const auto s = std::chrono::duration_cast<std::chrono::seconds>(time);
-	return to_human_readable(s);
-}
+	AdventCheck(tests_to_run.size() == results.size());
+	// Benchmarks, allocation counts and hardware counters would be skewed by other tests running at the same time.
+	// Isolated tests are forked one at a time, so no other thread is holding a lock the child might need.
+	if (options.num_jobs <= 1u || options.benchmark || options.track_allocations || options.hardware_counters || options.isolate)
+	{
+		std::ranges::transform(tests_to_run, begin(results), [&options](const verification_test* test)
+			{
+				return run_test(*test, options);
+			});
+		return;
+	}
 
-std::string to_human_readable(std::chrono::microseconds time)
-{
-	const auto res = to_human_readable(time.count(), "us", "ms");
-	if (res.has_value())
-		return res.value();
+	std::vector<std::size_t> schedule(tests_to_run.size());
+	std::iota(begin(schedule), end(schedule), std::size_t{ 0u });
+	std::ranges::stable_sort(schedule, std::greater<int>{}, [&tests_to_run](std::size_t idx)
+		{
+			return get_schedule_priority(*tests_to_run[idx]);
+		});
 
-	const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(time);
-	return to_human_readable(ms);
+	utils::thread_pool pool{ options.num_jobs };
+	for (std::size_t idx : schedule)
+	{
+		pool.submit([&tests_to_run, &results, &options, idx]()
+			{
+				// In release builds test_execute_wrapper lets failures through, and anything escaping here would
+				// escape a thread_pool worker. Report it as a failure of this test instead.
+				const verification_test& test = *tests_to_run[idx];
+				auto record_failure = [&](std::string_view message)
+					{
+						results[idx] = test_result{ std::string{ test.name }, std::string{ "ERROR: " } + std::string{ message },
+							to_string(test.get_expected_result()), test_status::fail };
+					};
+				try
+				{
+					results[idx] = run_test(test, options);
+				}
+				catch (const advent::test_failed& tf)
+				{
+					record_failure(tf.what());
+				}
+				catch (const std::exception& e)
+				{
+					record_failure(e.what());
+				}
+				catch (...)
+				{
+					record_failure("Unknown exception");
+				}
+			});
+	}
+	pool.wait();
 }
 
-std::string to_human_readable(std::chrono::nanoseconds time)
+// Returns false if any test regressed against the baseline.
+bool write_and_compare_results(std::span<const test_result> results, const verification_options& options)
 {
-	const auto res = to_human_readable(time.count(), "ns", "us");
-	if (res.has_value())
-		return res.value();
+	auto write_file = [results](const std::string& path, auto write_fn)
+		{
+			if (path.empty()) return;
+			std::ofstream output{ path };
+			if (!output.is_open())
+			{
+				std::cerr << "ERROR: Could not open '" << path << "' for writing.\n";
+				return;
+			}
+			write_fn(output, results);
+			std::cout << "Wrote results to " << path << '\n';
+		};
+	write_file(options.json_output_path, advent::results_io::write_json);
+	write_file(options.csv_output_path, advent::results_io::write_csv);
 
-	const auto us = std::chrono::duration_cast<std::chrono::microseconds>(time);
-	return to_human_readable(us);
-}
+	if (options.baseline_path.empty()) return true;
 
-template <typename TestType>
-ResultType test_execute_wrapper(TestType test)
-{
-#ifdef NDEBUG
-	return test.execute();
-#else
-	try
+	std::ifstream baseline_file{ options.baseline_path };
+	if (!baseline_file.is_open())
 	{
-		return test.execute();
+		std::cerr << "ERROR: Could not open baseline '" << options.baseline_path << "'.\n";
+		return false;
 	}
-	catch (const advent::test_failed& tf)
+	const auto baseline = advent::results_io::read_json_baseline(baseline_file);
+	const auto regressions = advent::results_io::find_regressions(results, baseline, options.regression_threshold);
+	std::cout << "REGRESSIONS (more than " << options.regression_threshold * 100.0 << "% slower than " << options.baseline_path << "): " << regressions.size() << '\n';
+	for (const advent::results_io::regression& r : regressions)
 	{
-		return std::string{ "ERROR: " } + std::string{ tf.what() };
+		const double ratio = static_cast<double>(r.current_time.count()) / static_cast<double>(std::max(r.baseline_time, std::chrono::nanoseconds{ 1 }).count());
+		std::cout << "    " << r.name << ": " << to_human_readable(r.baseline_time) << " -> " << to_human_readable(r.current_time)
+			<< " (" << std::setprecision(3) << ratio << "x)\n";
 	}
-#endif
+	return regressions.empty();
 }
 
-template <typename TestType>
-std::pair<ResultType,std::chrono::nanoseconds> run_test_func(TestType test)
+bool verify_all(const std::vector<std::string_view>& filter)
 {
-	const auto start_time = std::chrono::high_resolution_clock::now();
-	const ResultType res = test_execute_wrapper(std::move(test));
-	const auto end_time = std::chrono::high_resolution_clock::now();
-	return std::pair{res, end_time - start_time};
+	verification_options options;
+	options.filters = filter;
+	return verify_all(options);
 }
 
-struct TestExecutor
+bool verify_all(const verification_options& options)
 {
-	template <typename TestType>
-	std::pair<ResultType,std::chrono::nanoseconds> operator()(TestType test) { return run_test_func(std::move(test)); }
-};
-
-test_result run_test(const verification_test& test, const std::vector<std::string_view>& filter)
-{
-	if(!filter.empty())
+	if (options.isolate && !advent::platform::can_run_in_child_process())
 	{
-		auto filter_pred = [name = std::string_view{ test.name }](std::string_view filter_item)
-		{
-			return name.find(filter_item) != name.npos;
-		};
-		const bool matches_filter = std::ranges::any_of(filter, filter_pred);
-		if(!matches_filter)
-		{
-			return test_result{
-				test.name,
-				"",
-				to_string(test.expected_result),
-				test_status::filtered
-			};
-		}
+		std::cout << "WARNING: Isolation mode is only supported on POSIX systems. Running every test in this process.\n";
+		verification_options in_process_options = options;
+		in_process_options.isolate = false;
+		return verify_all(in_process_options);
 	}
-	std::cout << "Running test " << test.name << "...";
-	const auto [res,time_taken] = std::visit(TestExecutor{}, test.test_func);
-	const auto string_result = to_string(res);
-	std::cout << "\nFinished " << test.name << ": took " << to_human_readable(time_taken) <<  " and got " << string_result << '\n';
-	auto get_result = [&](test_status status)
-	{
-		return test_result{ test.name,string_result,to_string(test.expected_result),status,time_taken };
-	};
-
-	if(!test.expected_result.has_value())
+	const std::vector<std::string_view>& filter = options.filters;
+	// Otherwise every run after the first would skip reading and parsing the input, and only the first run's time
+	// would include them.
+	const bool was_input_caching_enabled = advent::is_input_caching_enabled();
+	if (options.benchmark)
 	{
-		return get_result(test_status::unknown);
+		advent::set_input_caching_enabled(false);
+		if (!advent::platform::pin_current_thread_to_core(advent::platform::get_benchmark_core()))
+		{
+			std::cout << "WARNING: Could not pin benchmark thread to a core. Results may be noisier.\n";
+		}
 	}
-	else
+	if (options.track_allocations)
 	{
-		return get_result(string_result == *test.expected_result ? test_status::pass : test_status::fail);
+		advent::allocations::set_tracking_enabled(true);
 	}
-}
+	const auto wall_start_time = std::chrono::steady_clock::now();
+	const auto cpu_start_time = advent::platform::get_process_cpu_time();
 
-bool verify_all(const std::vector<std::string_view>& filter)
-{
+	std::vector<const verification_test*> selected_tests;
+	select_tests(tests, filter, selected_tests);
 #if UTILS_TESTING
-	const std::size_t NUM_TESTS = std::size(tests) + utils::testing::get_all_tests().size();
-	std::vector<test_result> results;
-	results.reserve(NUM_TESTS);
-	results.resize(std::size(tests));
-#else
-	constexpr auto NUM_TESTS = std::size(tests);
-	auto result_ptr = std::make_unique<std::array<test_result, NUM_TESTS>>();
-	auto& results = *result_ptr;
+	select_tests(utils::testing::get_all_tests(), filter, selected_tests);
 #endif
 
-	auto test_lambda = [&filter](const verification_test& test)
-		{
-			return run_test(test, filter);
-		};
-	std::ranges::transform(tests, begin(results),test_lambda);
+	std::vector<test_result> results(selected_tests.size());
+	run_tests(selected_tests, results, options);
 
-#if UTILS_TESTING
-	std::ranges::transform(utils::testing::get_all_tests(), std::back_inserter(results), test_lambda);
-#endif
+	if (options.benchmark)
+	{
+		advent::platform::unpin_current_thread();
+		advent::set_input_caching_enabled(was_input_caching_enabled);
+	}
+	advent::allocations::set_tracking_enabled(false);
+
+	const auto wall_time = std::chrono::steady_clock::now() - wall_start_time;
+	const auto cpu_time = advent::platform::get_process_cpu_time() - cpu_start_time;
 
-	auto result_to_string = [&filter](const test_result& result)
+	auto result_to_string = [&filter, &options](const test_result& result)
 	{
 		std::ostringstream oss;
 		oss << result.name << ": " << result.result << " - ";
 		switch (result.status)
 		{
 		case test_status::pass:
-			oss << "PASS\n";
+			oss << "PASS";
 			break;
 		case test_status::fail:
-			oss << "FAIL (expected " << result.expected << ")\n";
+			oss << "FAIL (expected " << result.expected << ")";
 			break;
 		case test_status::filtered:
 			return std::string{ "" };
+		case test_status::timeout:
+			oss << "TIMEOUT (over " << to_human_readable(options.timeout) << ")";
+			break;
 		default: // unknown
-			oss << "[Unknown]\n";
+			oss << "[Unknown]";
 			break;
 		}
+		if (!result.counters.empty())
+		{
+			oss << " [" << to_human_readable(result.representative_time()) << ", " << to_string(result.counters) << ']';
+		}
+		oss << '\n';
 		return oss.str();
 	};
 
 	std::ranges::transform(results,std::ostream_iterator<std::string>(std::cout), result_to_string);
 
+	if (options.benchmark)
+	{
+		std::cout << "BENCHMARKS (" << options.benchmark_warmups << " warmup runs each):\n";
+		for (const test_result& result : results)
+		{
+			if (!result.benchmark.has_value()) continue;
+			std::cout << "    " << result.name << ": " << to_string(*result.benchmark) << '\n';
+		}
+	}
+
 	auto get_count = [&results](auto pred)
 	{
 		return std::ranges::count_if(results, pred);
@@ -284,52 +472,173 @@ bool verify_all(const std::vector<std::string_view>& filter)
 		"    PASSED : " << get_count(check_result<test_status::pass>) << "\n"
 		"    FAILED : " << get_count(check_result<test_status::fail>) << "\n"
 		"    UNKNOWN: " << get_count(check_result<test_status::unknown>) << "\n"
-		"    TIME   : " << to_human_readable(total_time) << '\n';
-	return std::ranges::none_of(results,check_result<test_status::fail>);
+		"    TIMEOUT: " << get_count(check_result<test_status::timeout>) << "\n"
+		"    TIME   : " << to_human_readable(total_time) << "\n"
+		"    WALL   : " << to_human_readable(std::chrono::duration_cast<std::chrono::nanoseconds>(wall_time)) << "\n"
+		"    CPU    : " << to_human_readable(cpu_time) << '\n';
+	const bool regressions_passed = write_and_compare_results(results, options);
+	return std::ranges::none_of(results,check_result<test_status::fail>)
+		&& std::ranges::none_of(results, check_result<test_status::timeout>)
+		&& regressions_passed;
 }
 
-verification_test make_test(std::string name, TestFunc func, int64_t result)
+namespace
 {
-	return make_test(std::move(name), func, std::to_string(result));
-}
+	// Supports * (any run of characters) and ? (any single character).
+	bool matches_wildcard(std::string_view pattern, std::string_view name)
+	{
+		std::size_t pattern_idx = 0u;
+		std::size_t name_idx = 0u;
+		std::size_t star_idx = pattern.npos;
+		std::size_t star_match_idx = 0u;
+		while (name_idx < name.size())
+		{
+			if (pattern_idx < pattern.size() && (pattern[pattern_idx] == '?' || pattern[pattern_idx] == name[name_idx]))
+			{
+				++pattern_idx;
+				++name_idx;
+			}
+			else if (pattern_idx < pattern.size() && pattern[pattern_idx] == '*')
+			{
+				star_idx = pattern_idx++;
+				star_match_idx = name_idx;
+			}
+			else if (star_idx != pattern.npos)
+			{
+				// Let the last star swallow one more character and try again.
+				pattern_idx = star_idx + 1u;
+				name_idx = ++star_match_idx;
+			}
+			else
+			{
+				return false;
+			}
+		}
+		return std::ranges::all_of(pattern.substr(std::min(pattern_idx, pattern.size())), [](char c) { return c == '*'; });
+	}
 
-verification_test make_test(std::string name, TestFunc func, uint64_t result)
-{
-	return make_test(std::move(name), func, std::to_string(result));
-}
+	std::vector<std::filesystem::path> find_batch_inputs(const std::string& input_pattern)
+	{
+		namespace fs = std::filesystem;
+		const fs::path pattern_path{ input_pattern };
+		std::vector<fs::path> result;
+		std::error_code error;
+		if (fs::is_regular_file(pattern_path, error))
+		{
+			result.push_back(pattern_path);
+			return result;
+		}
 
-verification_test make_test(std::string name, TestFunc func, std::string result)
-{
-	return verification_test{ std::move(name),func,std::move(result) };
+		const bool is_directory = fs::is_directory(pattern_path, error);
+		const fs::path directory = is_directory ? pattern_path : pattern_path.parent_path();
+		const std::string name_pattern = is_directory ? std::string{ "*" } : pattern_path.filename().string();
+		for (const fs::directory_entry& entry : fs::directory_iterator{ directory.empty() ? fs::path{ "." } : directory, error })
+		{
+			if (entry.is_regular_file() && matches_wildcard(name_pattern, entry.path().filename().string()))
+			{
+				result.push_back(entry.path());
+			}
+		}
+		std::ranges::sort(result);
+		return result;
+	}
 }
 
-verification_test make_test(std::string name, TestFunc func, Dummy)
+bool run_batch(const batch_options& options)
 {
-	return verification_test{ std::move(name),func };
-}
+	const advent::view_solver_func solver = advent::get_view_solver(options.day, options.part);
+	if (solver == nullptr)
+	{
+		std::cerr << "ERROR: There is no solution for day " << options.day << " part " << options.part << ".\n";
+		return false;
+	}
 
-verification_test make_test(std::string name, TestFuncWithArg func, int64_t result, std::string arg)
-{
-	return make_test(std::move(name), func, std::to_string(result), std::move(arg));
-}
+	const std::vector<std::filesystem::path> input_files = find_batch_inputs(options.input_pattern);
+	if (input_files.empty())
+	{
+		std::cerr << "ERROR: No input files match '" << options.input_pattern << "'.\n";
+		return false;
+	}
 
-verification_test make_test(std::string name, TestFuncWithArg func, uint64_t result, std::string arg)
-{
-	return make_test(std::move(name), func, std::to_string(result), std::move(arg));
+	std::mutex output_mutex;
+	std::atomic<std::size_t> total_bytes{ 0u };
+	std::atomic<std::size_t> num_failed{ 0u };
+	auto run_file = [solver, &output_mutex, &total_bytes, &num_failed](const std::filesystem::path& file)
+		{
+			const auto start_time = std::chrono::steady_clock::now();
+			std::string result;
+			try
+			{
+				const advent::mapped_input input{ file.string() };
+				total_bytes += input.size();
+				result = to_string(solver(input.view()));
+			}
+			catch (const advent::test_failed& tf)
+			{
+				result = std::string{ "ERROR: " } + std::string{ tf.what() };
+				++num_failed;
+			}
+			catch (const std::exception& e)
+			{
+				// Anything escaping here would escape a thread_pool worker and end the whole batch.
+				result = std::string{ "ERROR: " } + e.what();
+				++num_failed;
+			}
+			const std::chrono::nanoseconds time_taken = std::chrono::steady_clock::now() - start_time;
+			std::scoped_lock lock{ output_mutex };
+			std::cout << file.string() << ": " << result << " (" << to_human_readable(time_taken) << ")\n";
+		};
+
+	const auto start_time = std::chrono::steady_clock::now();
+	if (options.num_jobs <= 1u)
+	{
+		std::ranges::for_each(input_files, run_file);
+	}
+	else
+	{
+		utils::thread_pool pool{ options.num_jobs };
+		for (const std::filesystem::path& file : input_files)
+		{
+			pool.submit([&run_file, &file]() { run_file(file); });
+		}
+		pool.wait();
+	}
+	const std::chrono::nanoseconds wall_time = std::chrono::steady_clock::now() - start_time;
+
+	const double seconds = std::max(std::chrono::duration<double>{ wall_time }.count(), 1e-9);
+	const double megabytes = static_cast<double>(total_bytes) / (1024.0 * 1024.0);
+	std::cout <<
+		"BATCH (day " << options.day << " part " << options.part << ", " << options.num_jobs << " jobs):\n"
+		"    FILES  : " << input_files.size() << " (" << num_failed << " failed)\n"
+		"    SIZE   : " << std::fixed << std::setprecision(2) << megabytes << "MB\n"
+		"    WALL   : " << to_human_readable(wall_time) << "\n"
+		"    FILES/S: " << static_cast<double>(input_files.size()) / seconds << "\n"
+		"    MB/S   : " << megabytes / seconds << '\n';
+	return num_failed == 0u;
 }
 
-verification_test make_test(std::string name, TestFuncWithArg func, std::string result, std::string arg)
+ResultType verification_test::execute() const
 {
-	return verification_test{std::move(name), func, std::move(arg), std::move(result)};
+	if (func != nullptr)
+	{
+		return func();
+	}
+	AdventCheck(func_with_arg != nullptr);
+	auto input = advent::open_view_stream(arg);
+	return func_with_arg(input);
 }
 
-verification_test make_test(std::string name, TestFuncWithArg func, Dummy, std::string arg)
+namespace
 {
-	return verification_test{std::move(name), func, std::move(arg)};
+	struct ExpectedResultStringifier
+	{
+		std::optional<std::string> operator()(std::monostate) const { return std::nullopt; }
+		std::optional<std::string> operator()(int64_t in) const { return std::to_string(in); }
+		std::optional<std::string> operator()(std::string_view in) const { return std::string{ in }; }
+	};
 }
 
-ResultType TestWithArgExecutable::execute()
+std::optional<std::string> verification_test::get_expected_result() const
 {
-	std::istringstream iss{ std::move(arg)};
-	return func(iss);
+	return std::visit(ExpectedResultStringifier{}, expected_result);
 }
\ No newline at end of file
@@ -0,0 +1,138 @@
+#include "advent/advent_perf_counters.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+namespace
+{
+	struct counter_definition
+	{
+		const char* name;
+		uint32_t type;
+		uint64_t config;
+	};
+
+	constexpr uint64_t l1d_read_misses = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+
+	constexpr std::array counter_definitions
+	{
+		counter_definition{ "cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+		counter_definition{ "instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+		counter_definition{ "l1d_misses", PERF_TYPE_HW_CACHE, l1d_read_misses },
+		counter_definition{ "llc_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+		counter_definition{ "branch_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+	};
+
+	int open_counter(const counter_definition& definition)
+	{
+		perf_event_attr attr{};
+		attr.size = sizeof(attr);
+		attr.type = definition.type;
+		attr.config = definition.config;
+		attr.disabled = 1;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		attr.inherit = 1;
+		attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+		return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+	}
+
+	// When there are more counters than hardware registers the kernel time-slices them,
+	// so scale the count up to cover the whole time the counter was enabled.
+	std::optional<int64_t> read_counter(int handle)
+	{
+		struct
+		{
+			uint64_t value;
+			uint64_t time_enabled;
+			uint64_t time_running;
+		} data{};
+		if (read(handle, &data, sizeof(data)) != static_cast<ssize_t>(sizeof(data))) return std::nullopt;
+		if (data.time_running == 0u) return std::nullopt;
+		const double scale = static_cast<double>(data.time_enabled) / static_cast<double>(data.time_running);
+		return static_cast<int64_t>(static_cast<double>(data.value) * scale);
+	}
+}
+
+advent::perf_counters::perf_counters()
+{
+	static_assert(counter_definitions.size() == num_counters);
+	std::ranges::transform(counter_definitions, begin(m_handles), open_counter);
+}
+
+advent::perf_counters::~perf_counters()
+{
+	for (int handle : m_handles)
+	{
+		if (handle >= 0)
+		{
+			close(handle);
+		}
+	}
+}
+
+bool advent::perf_counters::is_available() const noexcept
+{
+	return std::ranges::any_of(m_handles, [](int handle) { return handle >= 0; });
+}
+
+void advent::perf_counters::start()
+{
+	for (int handle : m_handles)
+	{
+		if (handle < 0) continue;
+		ioctl(handle, PERF_EVENT_IOC_RESET, 0);
+		ioctl(handle, PERF_EVENT_IOC_ENABLE, 0);
+	}
+}
+
+std::vector<test_counter> advent::perf_counters::stop()
+{
+	for (int handle : m_handles)
+	{
+		if (handle < 0) continue;
+		ioctl(handle, PERF_EVENT_IOC_DISABLE, 0);
+	}
+
+	std::vector<test_counter> result;
+	for (std::size_t i = 0u; i < num_counters; ++i)
+	{
+		if (m_handles[i] < 0) continue;
+		if (const std::optional<int64_t> value = read_counter(m_handles[i]))
+		{
+			result.push_back(test_counter{ counter_definitions[i].name, *value });
+		}
+	}
+	return result;
+}
+#else
+advent::perf_counters::perf_counters()
+{
+	m_handles.fill(-1);
+}
+
+advent::perf_counters::~perf_counters() = default;
+
+bool advent::perf_counters::is_available() const noexcept
+{
+	return false;
+}
+
+void advent::perf_counters::start()
+{
+}
+
+std::vector<test_counter> advent::perf_counters::stop()
+{
+	return std::vector<test_counter>{};
+}
+#endif
\ No newline at end of file
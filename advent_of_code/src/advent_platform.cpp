@@ -0,0 +1,250 @@
+#include "advent/advent_platform.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <thread>
+#include <optional>
+#include <iostream>
+#include <cerrno>
+#endif
+
+#ifdef _WIN32
+namespace
+{
+	std::chrono::nanoseconds to_duration(FILETIME ft)
+	{
+		ULARGE_INTEGER val;
+		val.LowPart = ft.dwLowDateTime;
+		val.HighPart = ft.dwHighDateTime;
+		// FILETIME counts in 100ns ticks.
+		return std::chrono::nanoseconds{ static_cast<long long>(val.QuadPart) * 100 };
+	}
+}
+
+std::chrono::nanoseconds advent::platform::get_process_cpu_time()
+{
+	FILETIME creation_time, exit_time, kernel_time, user_time;
+	if (!GetProcessTimes(GetCurrentProcess(), &creation_time, &exit_time, &kernel_time, &user_time))
+	{
+		return std::chrono::nanoseconds{ 0 };
+	}
+	return to_duration(kernel_time) + to_duration(user_time);
+}
+
+namespace
+{
+	thread_local DWORD_PTR original_thread_mask = 0;
+}
+
+bool advent::platform::pin_current_thread_to_core(std::size_t core_idx)
+{
+	if (core_idx >= sizeof(DWORD_PTR) * 8) return false;
+	const DWORD_PTR mask = DWORD_PTR{ 1 } << core_idx;
+	const DWORD_PTR previous_mask = SetThreadAffinityMask(GetCurrentThread(), mask);
+	if (previous_mask == 0) return false;
+	if (original_thread_mask == 0)
+	{
+		original_thread_mask = previous_mask;
+	}
+	return true;
+}
+
+std::size_t advent::platform::get_benchmark_core()
+{
+	DWORD_PTR process_mask = 0;
+	DWORD_PTR system_mask = 0;
+	if (!GetProcessAffinityMask(GetCurrentProcess(), &process_mask, &system_mask) || process_mask == 0)
+	{
+		return 0u;
+	}
+	std::size_t core_idx = sizeof(DWORD_PTR) * 8 - 1;
+	while ((process_mask & (DWORD_PTR{ 1 } << core_idx)) == 0)
+	{
+		--core_idx;
+	}
+	return core_idx;
+}
+
+void advent::platform::unpin_current_thread()
+{
+	if (original_thread_mask == 0) return;
+	SetThreadAffinityMask(GetCurrentThread(), original_thread_mask);
+	original_thread_mask = 0;
+}
+
+bool advent::platform::can_run_in_child_process()
+{
+	return false;
+}
+
+advent::platform::child_process_result advent::platform::run_in_child_process(const std::function<std::string()>&)
+{
+	return child_process_result{};
+}
+#else
+namespace
+{
+	std::chrono::nanoseconds to_duration(timeval tv)
+	{
+		return std::chrono::seconds{ tv.tv_sec } + std::chrono::microseconds{ tv.tv_usec };
+	}
+}
+
+std::chrono::nanoseconds advent::platform::get_process_cpu_time()
+{
+	rusage usage{};
+	if (getrusage(RUSAGE_SELF, &usage) != 0)
+	{
+		return std::chrono::nanoseconds{ 0 };
+	}
+	return to_duration(usage.ru_utime) + to_duration(usage.ru_stime);
+}
+
+#ifdef __linux__
+namespace
+{
+	thread_local std::optional<cpu_set_t> original_thread_mask;
+}
+#endif
+
+bool advent::platform::pin_current_thread_to_core(std::size_t core_idx)
+{
+#ifdef __linux__
+	if (core_idx >= CPU_SETSIZE) return false;
+	cpu_set_t previous_mask;
+	if (pthread_getaffinity_np(pthread_self(), sizeof(previous_mask), &previous_mask) != 0) return false;
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	CPU_SET(core_idx, &cpu_set);
+	if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) != 0) return false;
+	if (!original_thread_mask.has_value())
+	{
+		original_thread_mask = previous_mask;
+	}
+	return true;
+#else
+	return false;
+#endif
+}
+
+std::size_t advent::platform::get_benchmark_core()
+{
+#ifdef __linux__
+	cpu_set_t process_mask;
+	CPU_ZERO(&process_mask);
+	if (sched_getaffinity(0, sizeof(process_mask), &process_mask) == 0)
+	{
+		for (std::size_t core_idx = CPU_SETSIZE; core_idx-- > 0u;)
+		{
+			if (CPU_ISSET(core_idx, &process_mask)) return core_idx;
+		}
+	}
+#endif
+	const unsigned int num_cores = std::thread::hardware_concurrency();
+	return num_cores > 0u ? num_cores - 1u : 0u;
+}
+
+void advent::platform::unpin_current_thread()
+{
+#ifdef __linux__
+	if (!original_thread_mask.has_value()) return;
+	pthread_setaffinity_np(pthread_self(), sizeof(*original_thread_mask), &*original_thread_mask);
+	original_thread_mask.reset();
+#endif
+}
+
+bool advent::platform::can_run_in_child_process()
+{
+	return true;
+}
+
+advent::platform::child_process_result advent::platform::run_in_child_process(const std::function<std::string()>& work)
+{
+	child_process_result result;
+	int pipe_fds[2];
+	if (pipe(pipe_fds) != 0) return result;
+
+	// Anything still buffered would otherwise be written twice: once by each process.
+	std::cout.flush();
+	std::cerr.flush();
+
+	const pid_t child = fork();
+	if (child < 0)
+	{
+		close(pipe_fds[0]);
+		close(pipe_fds[1]);
+		return result;
+	}
+
+	if (child == 0)
+	{
+		close(pipe_fds[0]);
+		int exit_code = 0;
+		try
+		{
+			const std::string output = work();
+			std::string_view remaining = output;
+			while (!remaining.empty())
+			{
+				const ssize_t num_written = write(pipe_fds[1], remaining.data(), remaining.size());
+				if (num_written < 0 && errno == EINTR) continue;
+				if (num_written <= 0)
+				{
+					exit_code = 1;
+					break;
+				}
+				remaining.remove_prefix(static_cast<std::size_t>(num_written));
+			}
+		}
+		catch (...)
+		{
+			exit_code = 1;
+		}
+		std::cout.flush();
+		std::cerr.flush();
+		close(pipe_fds[1]);
+		// Skip static destructors and atexit handlers: they belong to the parent.
+		_exit(exit_code);
+	}
+
+	close(pipe_fds[1]);
+	char buffer[4096];
+	while (true)
+	{
+		const ssize_t num_read = read(pipe_fds[0], buffer, sizeof(buffer));
+		if (num_read < 0 && errno == EINTR) continue;
+		if (num_read <= 0) break;
+		result.output.append(buffer, static_cast<std::size_t>(num_read));
+	}
+	close(pipe_fds[0]);
+
+	// wait4 rather than getrusage(RUSAGE_CHILDREN), which would mix in every other child reaped so far.
+	int status = 0;
+	rusage usage{};
+	pid_t waited = -1;
+	do
+	{
+		waited = wait4(child, &status, 0, &usage);
+	} while (waited < 0 && errno == EINTR);
+	if (waited != child) return result;
+
+	result.completed = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+#ifdef __APPLE__
+	// macOS reports ru_maxrss in bytes, Linux in kilobytes.
+	result.max_rss_bytes = static_cast<int64_t>(usage.ru_maxrss);
+#else
+	result.max_rss_bytes = static_cast<int64_t>(usage.ru_maxrss) * 1024;
+#endif
+	result.major_page_faults = static_cast<int64_t>(usage.ru_majflt);
+	result.minor_page_faults = static_cast<int64_t>(usage.ru_minflt);
+	return result;
+}
+#endif
\ No newline at end of file
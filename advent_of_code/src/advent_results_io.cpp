@@ -0,0 +1,334 @@
+#include "advent/advent_results_io.h"
+
+#include <iostream>
+#include <sstream>
+#include <map>
+#include <algorithm>
+#include <cctype>
+
+#include "advent/advent_assert.h"
+
+std::string_view to_string(test_status status)
+{
+	switch (status)
+	{
+	case test_status::pass:
+		return "pass";
+	case test_status::fail:
+		return "fail";
+	case test_status::unknown:
+		return "unknown";
+	case test_status::filtered:
+		return "filtered";
+	case test_status::timeout:
+		return "timeout";
+	}
+	return "unknown";
+}
+
+namespace
+{
+	std::string escape_json(std::string_view in)
+	{
+		std::ostringstream oss;
+		for (char c : in)
+		{
+			switch (c)
+			{
+			case '"':
+				oss << "\\\"";
+				break;
+			case '\\':
+				oss << "\\\\";
+				break;
+			case '\n':
+				oss << "\\n";
+				break;
+			case '\r':
+				oss << "\\r";
+				break;
+			case '\t':
+				oss << "\\t";
+				break;
+			default:
+				if (static_cast<unsigned char>(c) < 0x20)
+				{
+					oss << "\\u00" << "0123456789abcdef"[(c >> 4) & 0xF] << "0123456789abcdef"[c & 0xF];
+				}
+				else
+				{
+					oss << c;
+				}
+				break;
+			}
+		}
+		return oss.str();
+	}
+
+	std::string escape_csv(std::string_view in)
+	{
+		const bool needs_quotes = in.find_first_of(",\"\n\r") != in.npos;
+		if (!needs_quotes) return std::string{ in };
+		std::string result{ '"' };
+		for (char c : in)
+		{
+			if (c == '"') result.push_back('"');
+			result.push_back(c);
+		}
+		result.push_back('"');
+		return result;
+	}
+
+	bool should_write(const test_result& result)
+	{
+		return result.status != test_status::filtered;
+	}
+
+	// Reads JSON into a flat map of leaf values, keyed by their path. E.g. {"a":[{"b":1}]} becomes "a[0].b" -> "1".
+	// This is enough to read back the files write_json produces without pulling in a full JSON library.
+	class json_flattener
+	{
+		std::string_view m_text;
+		std::size_t m_pos = 0u;
+		std::map<std::string, std::string> m_leaves;
+
+		void skip_whitespace()
+		{
+			while (m_pos < m_text.size() && std::isspace(static_cast<unsigned char>(m_text[m_pos]))) ++m_pos;
+		}
+
+		char peek()
+		{
+			skip_whitespace();
+			AdventCheckMsg(m_pos < m_text.size(), "Unexpected end of JSON");
+			return m_text[m_pos];
+		}
+
+		void expect(char c)
+		{
+			AdventCheckMsg(peek() == c, "Malformed JSON at offset", m_pos);
+			++m_pos;
+		}
+
+		std::string parse_string()
+		{
+			expect('"');
+			std::string result;
+			while (true)
+			{
+				AdventCheckMsg(m_pos < m_text.size(), "Unterminated JSON string");
+				const char c = m_text[m_pos++];
+				if (c == '"') return result;
+				if (c != '\\')
+				{
+					result.push_back(c);
+					continue;
+				}
+				AdventCheckMsg(m_pos < m_text.size(), "Unterminated JSON string");
+				const char escaped = m_text[m_pos++];
+				switch (escaped)
+				{
+				case 'n': result.push_back('\n'); break;
+				case 'r': result.push_back('\r'); break;
+				case 't': result.push_back('\t'); break;
+				case 'b': result.push_back('\b'); break;
+				case 'f': result.push_back('\f'); break;
+				case 'u':
+				{
+					AdventCheckMsg(m_pos + 4 <= m_text.size(), "Truncated JSON unicode escape");
+					const int code = std::stoi(std::string{ m_text.substr(m_pos, 4) }, nullptr, 16);
+					m_pos += 4;
+					// Only ASCII is ever written by write_json.
+					result.push_back(static_cast<char>(code < 0x80 ? code : '?'));
+					break;
+				}
+				default: result.push_back(escaped); break;
+				}
+			}
+		}
+
+		void parse_value(const std::string& path)
+		{
+			const char c = peek();
+			if (c == '{')
+			{
+				++m_pos;
+				if (peek() == '}') { ++m_pos; return; }
+				while (true)
+				{
+					const std::string key = parse_string();
+					expect(':');
+					parse_value(path.empty() ? key : path + '.' + key);
+					if (peek() == ',') { ++m_pos; continue; }
+					expect('}');
+					return;
+				}
+			}
+			if (c == '[')
+			{
+				++m_pos;
+				if (peek() == ']') { ++m_pos; return; }
+				for (std::size_t idx = 0u; ; ++idx)
+				{
+					parse_value(path + '[' + std::to_string(idx) + ']');
+					if (peek() == ',') { ++m_pos; continue; }
+					expect(']');
+					return;
+				}
+			}
+			if (c == '"')
+			{
+				m_leaves[path] = parse_string();
+				return;
+			}
+			const std::size_t start = m_pos;
+			while (m_pos < m_text.size() && std::string_view{ ",}] \t\r\n" }.find(m_text[m_pos]) == std::string_view::npos) ++m_pos;
+			AdventCheckMsg(m_pos > start, "Malformed JSON at offset", start);
+			m_leaves[path] = std::string{ m_text.substr(start, m_pos - start) };
+		}
+	public:
+		explicit json_flattener(std::string_view text) : m_text{ text } {}
+		std::map<std::string, std::string> parse()
+		{
+			parse_value("");
+			return std::move(m_leaves);
+		}
+	};
+}
+
+void advent::results_io::write_json(std::ostream& output, std::span<const test_result> results)
+{
+	output << "{\n\t\"tests\": [";
+	bool is_first = true;
+	for (const test_result& result : results)
+	{
+		if (!should_write(result)) continue;
+		output << (is_first ? "\n" : ",\n");
+		is_first = false;
+		output << "\t\t{\n"
+			<< "\t\t\t\"name\": \"" << escape_json(result.name) << "\",\n"
+			<< "\t\t\t\"status\": \"" << to_string(result.status) << "\",\n"
+			<< "\t\t\t\"result\": \"" << escape_json(result.result) << "\",\n"
+			<< "\t\t\t\"expected\": \"" << escape_json(result.expected) << "\",\n"
+			<< "\t\t\t\"time_ns\": " << result.time_taken.count();
+		if (result.benchmark.has_value())
+		{
+			const benchmark_stats& stats = *result.benchmark;
+			output << ",\n\t\t\t\"benchmark\": {"
+				<< " \"samples\": " << stats.num_samples
+				<< ", \"min_ns\": " << stats.min.count()
+				<< ", \"median_ns\": " << stats.median.count()
+				<< ", \"mean_ns\": " << stats.mean.count()
+				<< ", \"p90_ns\": " << stats.p90.count()
+				<< ", \"p99_ns\": " << stats.p99.count()
+				<< ", \"stddev_ns\": " << stats.stddev.count()
+				<< " }";
+		}
+		if (!result.counters.empty())
+		{
+			output << ",\n\t\t\t\"counters\": {";
+			for (std::size_t i = 0u; i < result.counters.size(); ++i)
+			{
+				const test_counter& counter = result.counters[i];
+				output << (i == 0u ? " " : ", ") << '"' << escape_json(counter.name) << "\": " << counter.value;
+			}
+			output << " }";
+		}
+		output << "\n\t\t}";
+	}
+	output << "\n\t]\n}\n";
+}
+
+void advent::results_io::write_csv(std::ostream& output, std::span<const test_result> results)
+{
+	std::vector<std::string> counter_names;
+	for (const test_result& result : results)
+	{
+		for (const test_counter& counter : result.counters)
+		{
+			if (std::ranges::find(counter_names, counter.name) == end(counter_names))
+			{
+				counter_names.push_back(counter.name);
+			}
+		}
+	}
+
+	output << "name,status,result,expected,time_ns,samples,min_ns,median_ns,mean_ns,p90_ns,p99_ns,stddev_ns";
+	for (const std::string& counter_name : counter_names)
+	{
+		output << ',' << escape_csv(counter_name);
+	}
+	output << '\n';
+
+	for (const test_result& result : results)
+	{
+		if (!should_write(result)) continue;
+		output << escape_csv(result.name) << ','
+			<< to_string(result.status) << ','
+			<< escape_csv(result.result) << ','
+			<< escape_csv(result.expected) << ','
+			<< result.time_taken.count() << ',';
+		if (result.benchmark.has_value())
+		{
+			const benchmark_stats& stats = *result.benchmark;
+			output << stats.num_samples << ',' << stats.min.count() << ',' << stats.median.count() << ',' << stats.mean.count()
+				<< ',' << stats.p90.count() << ',' << stats.p99.count() << ',' << stats.stddev.count();
+		}
+		else
+		{
+			output << ",,,,,,";
+		}
+		for (const std::string& counter_name : counter_names)
+		{
+			output << ',';
+			const auto counter_it = std::ranges::find(result.counters, counter_name, &test_counter::name);
+			if (counter_it != end(result.counters))
+			{
+				output << counter_it->value;
+			}
+		}
+		output << '\n';
+	}
+}
+
+std::vector<advent::results_io::baseline_entry> advent::results_io::read_json_baseline(std::istream& input)
+{
+	const std::string text{ std::istreambuf_iterator<char>{input}, std::istreambuf_iterator<char>{} };
+	const std::map<std::string, std::string> leaves = json_flattener{ text }.parse();
+
+	std::vector<baseline_entry> result;
+	for (std::size_t idx = 0u; ; ++idx)
+	{
+		const std::string prefix = "tests[" + std::to_string(idx) + "].";
+		const auto name_it = leaves.find(prefix + "name");
+		if (name_it == end(leaves)) break;
+
+		auto median_it = leaves.find(prefix + "benchmark.median_ns");
+		if (median_it == end(leaves))
+		{
+			median_it = leaves.find(prefix + "time_ns");
+		}
+		if (median_it == end(leaves)) continue;
+		result.push_back(baseline_entry{ name_it->second, std::chrono::nanoseconds{ std::stoll(median_it->second) } });
+	}
+	return result;
+}
+
+std::vector<advent::results_io::regression> advent::results_io::find_regressions(std::span<const test_result> results, std::span<const baseline_entry> baseline, double threshold)
+{
+	std::vector<regression> result;
+	for (const test_result& current : results)
+	{
+		if (!should_write(current)) continue;
+		const auto baseline_it = std::ranges::find(baseline, current.name, &baseline_entry::name);
+		if (baseline_it == end(baseline)) continue;
+
+		const std::chrono::nanoseconds current_time = current.representative_time();
+		const double limit = static_cast<double>(baseline_it->time.count()) * (1.0 + threshold);
+		if (static_cast<double>(current_time.count()) > limit)
+		{
+			result.push_back(regression{ current.name, baseline_it->time, current_time });
+		}
+	}
+	return result;
+}
\ No newline at end of file
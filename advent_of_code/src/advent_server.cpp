@@ -0,0 +1,419 @@
+#include "advent/advent_server.h"
+#include "advent/advent_assert.h"
+#include "advent/advent_view_solvers.h"
+
+#include "utils/thread_pool.h"
+
+#include <iostream>
+#include <atomic>
+#include <utility>
+#include <variant>
+#include <format>
+#include <concepts>
+#include <exception>
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <poll.h>
+#include <unistd.h>
+#include <csignal>
+#include <cstring>
+#include <cerrno>
+
+namespace
+{
+	constexpr uint32_t shutdown_day = 0u;
+	// Real puzzle inputs are tens of kilobytes, and even large generated ones are a few megabytes.
+	constexpr uint64_t max_input_size = uint64_t{ 1u } << 28;
+	constexpr std::size_t input_chunk_size = std::size_t{ 1u } << 20;
+	constexpr std::size_t request_header_size = 16u;
+	constexpr std::size_t response_header_size = 12u;
+
+	enum class response_status : uint32_t
+	{
+		success = 0u,
+		failure = 1u
+	};
+
+	template <std::unsigned_integral T>
+	void append_integer(std::string& out, T value)
+	{
+		for (std::size_t i = 0u; i < sizeof(T); ++i)
+		{
+			out.push_back(static_cast<char>((value >> (8u * i)) & 0xffu));
+		}
+	}
+
+	template <std::unsigned_integral T>
+	T read_integer(const char* data)
+	{
+		T result = 0u;
+		for (std::size_t i = 0u; i < sizeof(T); ++i)
+		{
+			result |= static_cast<T>(static_cast<unsigned char>(data[i])) << (8u * i);
+		}
+		return result;
+	}
+
+	std::string make_request(uint32_t day, uint32_t part, std::string_view input)
+	{
+		std::string result;
+		result.reserve(request_header_size + input.size());
+		append_integer(result, day);
+		append_integer(result, part);
+		append_integer(result, static_cast<uint64_t>(input.size()));
+		result.append(input);
+		return result;
+	}
+
+	std::string make_response(response_status status, std::string_view body)
+	{
+		std::string result;
+		result.reserve(response_header_size + body.size());
+		append_integer(result, static_cast<uint32_t>(status));
+		append_integer(result, static_cast<uint64_t>(body.size()));
+		result.append(body);
+		return result;
+	}
+
+	struct ResultStringifier
+	{
+		std::string operator()(const std::string& in) const noexcept { return in; }
+		template <std::integral T>
+		std::string operator()(T in) const { return std::to_string(in); }
+	};
+
+	std::pair<response_status, std::string> solve_request(uint32_t day, uint32_t part, std::string_view input)
+	{
+		try
+		{
+			const advent::view_solver_func solver = advent::get_view_solver(static_cast<int>(day), static_cast<int>(part));
+			if (solver == nullptr)
+			{
+				return { response_status::failure, std::format("There is no solution for day {} part {}.", day, part) };
+			}
+			return { response_status::success, std::visit(ResultStringifier{}, solver(input)) };
+		}
+		catch (const advent::test_failed& tf)
+		{
+			return { response_status::failure, std::string{ tf.what() } };
+		}
+		catch (const std::exception& e)
+		{
+			return { response_status::failure, e.what() };
+		}
+		catch (...)
+		{
+			return { response_status::failure, "Unknown error." };
+		}
+	}
+
+	// Closes the socket when it goes out of scope.
+	class socket_handle
+	{
+		int m_fd = -1;
+	public:
+		explicit socket_handle(int fd) noexcept : m_fd{ fd } {}
+		socket_handle(socket_handle&& other) noexcept : m_fd{ std::exchange(other.m_fd, -1) } {}
+		socket_handle& operator=(socket_handle&&) = delete;
+		~socket_handle()
+		{
+			if (is_valid()) close(m_fd);
+		}
+		bool is_valid() const noexcept { return m_fd >= 0; }
+		int get() const noexcept { return m_fd; }
+	};
+
+	bool make_address(const std::string& socket_path, sockaddr_un& address)
+	{
+		address = sockaddr_un{};
+		address.sun_family = AF_UNIX;
+		if (socket_path.empty() || socket_path.size() >= sizeof(address.sun_path)) return false;
+		std::memcpy(address.sun_path, socket_path.c_str(), socket_path.size() + 1u);
+		return true;
+	}
+
+	// Returns false if the other end closed the connection or something went wrong before everything was read.
+	bool read_exact(int fd, char* data, std::size_t size)
+	{
+		while (size > 0u)
+		{
+			const ssize_t num_read = read(fd, data, size);
+			if (num_read < 0 && errno == EINTR) continue;
+			if (num_read <= 0) return false;
+			data += num_read;
+			size -= static_cast<std::size_t>(num_read);
+		}
+		return true;
+	}
+
+	bool write_all(int fd, std::string_view data)
+	{
+		while (!data.empty())
+		{
+			const ssize_t num_written = write(fd, data.data(), data.size());
+			if (num_written < 0 && errno == EINTR) continue;
+			if (num_written <= 0) return false;
+			data.remove_prefix(static_cast<std::size_t>(num_written));
+		}
+		return true;
+	}
+
+	// Waits for the socket to become readable. Gives up if the server starts shutting down.
+	bool wait_until_readable(int fd, const std::atomic_bool& stopping)
+	{
+		while (!stopping)
+		{
+			pollfd poll_info{ fd, POLLIN, 0 };
+			const int num_ready = poll(&poll_info, 1, 100);
+			if (num_ready > 0) return true;
+			if (num_ready < 0 && errno != EINTR) return false;
+		}
+		return false;
+	}
+
+	// Reads the input a chunk at a time, so the buffer only grows as fast as the client actually sends bytes
+	// rather than trusting the size in the header up front.
+	bool read_input(int fd, std::size_t size, std::string& input)
+	{
+		input.clear();
+		while (input.size() < size)
+		{
+			const std::size_t chunk_start = input.size();
+			input.resize(chunk_start + std::min(size - chunk_start, input_chunk_size));
+			if (!read_exact(fd, input.data() + chunk_start, input.size() - chunk_start)) return false;
+		}
+		return true;
+	}
+
+	// One open connection. Its requests are read on a thread of its own and solved on the pool, possibly several
+	// at once, so responses are written back in the order the requests arrived rather than as they finish.
+	class connection_state
+	{
+		socket_handle m_socket;
+		std::mutex m_write_mutex;
+		std::size_t m_next_response_idx = 0u;
+		std::map<std::size_t, std::string> m_waiting_responses;
+		bool m_write_failed = false;
+	public:
+		explicit connection_state(socket_handle socket) noexcept : m_socket{ std::move(socket) } {}
+		int get() const noexcept { return m_socket.get(); }
+
+		// Hands over the response to the request_idx'th request, and writes out every response that is now next in line.
+		void respond(std::size_t request_idx, std::string response)
+		{
+			std::scoped_lock lock{ m_write_mutex };
+			m_waiting_responses.emplace(request_idx, std::move(response));
+			for (auto it = m_waiting_responses.begin(); it != m_waiting_responses.end() && it->first == m_next_response_idx; it = m_waiting_responses.erase(it))
+			{
+				// Once the client stops listening, there's no point writing the rest.
+				m_write_failed = m_write_failed || !write_all(get(), it->second);
+				++m_next_response_idx;
+			}
+		}
+	};
+
+	void solve_on_pool(utils::thread_pool& pool, std::shared_ptr<connection_state> connection, std::size_t request_idx, uint32_t day, uint32_t part, std::string input)
+	{
+		pool.submit([connection = std::move(connection), request_idx, day, part, input = std::move(input)]()
+			{
+				try
+				{
+					const auto [status, body] = solve_request(day, part, input);
+					connection->respond(request_idx, make_response(status, body));
+				}
+				catch (...)
+				{
+					connection->respond(request_idx, make_response(response_status::failure, "Internal server error."));
+				}
+			});
+	}
+
+	// request_idx counts the requests read so far, so that an error can be answered in the next one's place.
+	void read_requests(const std::shared_ptr<connection_state>& connection, utils::thread_pool& pool, std::atomic_bool& stopping, std::size_t& request_idx)
+	{
+		while (wait_until_readable(connection->get(), stopping))
+		{
+			char header[request_header_size];
+			if (!read_exact(connection->get(), header, request_header_size)) return;
+			const uint32_t day = read_integer<uint32_t>(header);
+			const uint32_t part = read_integer<uint32_t>(header + 4);
+			const uint64_t input_size = read_integer<uint64_t>(header + 8);
+
+			if (input_size > max_input_size)
+			{
+				connection->respond(request_idx, make_response(response_status::failure, "Input too large."));
+				return;
+			}
+
+			std::string input;
+			if (!read_input(connection->get(), static_cast<std::size_t>(input_size), input)) return;
+
+			if (day == shutdown_day)
+			{
+				stopping = true;
+				connection->respond(request_idx, make_response(response_status::success, "Shutting down."));
+				return;
+			}
+
+			solve_on_pool(pool, connection, request_idx, day, part, std::move(input));
+			++request_idx;
+		}
+	}
+
+	// Runs on the connection's own thread. Nothing may escape it: the client gets a failure response and the
+	// connection is closed once the requests already on the pool have been answered.
+	void serve_connection(std::shared_ptr<connection_state> connection, utils::thread_pool& pool, std::atomic_bool& stopping)
+	{
+		std::size_t request_idx = 0u;
+		try
+		{
+			read_requests(connection, pool, stopping, request_idx);
+		}
+		catch (...)
+		{
+			connection->respond(request_idx, make_response(response_status::failure, "Internal server error."));
+		}
+	}
+
+	// A connection's reading thread, and whether it has finished so it can be joined without waiting.
+	struct connection_thread
+	{
+		std::thread thread;
+		std::shared_ptr<std::atomic_bool> finished;
+	};
+
+	socket_handle connect_to_server(const std::string& socket_path)
+	{
+		sockaddr_un address;
+		const bool valid_path = make_address(socket_path, address);
+		AdventCheckMsg(valid_path, "Bad socket path '", socket_path, '\'');
+		socket_handle result{ socket(AF_UNIX, SOCK_STREAM, 0) };
+		AdventCheckMsg(result.is_valid(), "Could not create a socket");
+		const bool connected = connect(result.get(), reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+		AdventCheckMsg(connected, "Could not connect to '", socket_path, '\'');
+		return result;
+	}
+
+	advent::server_response exchange(const std::string& socket_path, uint32_t day, uint32_t part, std::string_view input)
+	{
+		std::signal(SIGPIPE, SIG_IGN);
+		const socket_handle connection = connect_to_server(socket_path);
+		const bool sent = write_all(connection.get(), make_request(day, part, input));
+		AdventCheckMsg(sent, "Could not send request to '", socket_path, '\'');
+
+		char header[response_header_size];
+		const bool got_header = read_exact(connection.get(), header, response_header_size);
+		AdventCheckMsg(got_header, "No response from '", socket_path, '\'');
+		const uint32_t status = read_integer<uint32_t>(header);
+		const uint64_t size = read_integer<uint64_t>(header + 4);
+
+		advent::server_response result;
+		result.succeeded = (status == static_cast<uint32_t>(response_status::success));
+		result.result.resize(static_cast<std::size_t>(size));
+		const bool got_body = read_exact(connection.get(), result.result.data(), result.result.size());
+		AdventCheckMsg(got_body, "Incomplete response from '", socket_path, '\'');
+		return result;
+	}
+}
+
+bool advent::run_server(const server_options& options)
+{
+	// A client hanging up mid-response should only end that connection.
+	std::signal(SIGPIPE, SIG_IGN);
+
+	sockaddr_un address;
+	if (!make_address(options.socket_path, address))
+	{
+		std::cerr << "ERROR: Bad socket path '" << options.socket_path << "'.\n";
+		return false;
+	}
+
+	const socket_handle listener{ socket(AF_UNIX, SOCK_STREAM, 0) };
+	if (!listener.is_valid())
+	{
+		std::cerr << "ERROR: Could not create a socket.\n";
+		return false;
+	}
+
+	unlink(options.socket_path.c_str());
+	if (bind(listener.get(), reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 || listen(listener.get(), SOMAXCONN) != 0)
+	{
+		std::cerr << "ERROR: Could not listen on '" << options.socket_path << "': " << std::strerror(errno) << '\n';
+		return false;
+	}
+
+	std::cout << "Listening on " << options.socket_path << " with " << options.num_jobs << " jobs." << std::endl;
+
+	std::atomic_bool stopping{ false };
+	{
+		// Declared before the connection threads, which submit to it, so it outlives them.
+		utils::thread_pool pool{ std::max(options.num_jobs, std::size_t{ 1u }) };
+		std::vector<connection_thread> connections;
+		const auto join_finished = [&connections](bool all)
+			{
+				std::erase_if(connections, [all](connection_thread& ct)
+					{
+						if (!all && !*ct.finished) return false;
+						ct.thread.join();
+						return true;
+					});
+			};
+
+		while (wait_until_readable(listener.get(), stopping))
+		{
+			socket_handle socket{ accept(listener.get(), nullptr, nullptr) };
+			if (!socket.is_valid()) continue;
+			join_finished(false);
+			auto connection = std::make_shared<connection_state>(std::move(socket));
+			auto finished = std::make_shared<std::atomic_bool>(false);
+			std::thread thread{ [connection = std::move(connection), finished, &pool, &stopping]() mutable
+				{
+					serve_connection(std::move(connection), pool, stopping);
+					*finished = true;
+				} };
+			connections.push_back(connection_thread{ std::move(thread), std::move(finished) });
+		}
+		join_finished(true);
+	}
+
+	unlink(options.socket_path.c_str());
+	std::cout << "Server stopped." << std::endl;
+	return true;
+}
+
+advent::server_response advent::send_server_request(const std::string& socket_path, int day, int part, std::string_view input)
+{
+	AdventCheckMsg(day != static_cast<int>(shutdown_day), "Use send_server_shutdown to stop the server");
+	return exchange(socket_path, static_cast<uint32_t>(day), static_cast<uint32_t>(part), input);
+}
+
+void advent::send_server_shutdown(const std::string& socket_path)
+{
+	exchange(socket_path, shutdown_day, 0u, std::string_view{});
+}
+#else
+bool advent::run_server(const server_options&)
+{
+	std::cerr << "ERROR: Server mode is only supported on POSIX systems.\n";
+	return false;
+}
+
+advent::server_response advent::send_server_request(const std::string&, int, int, std::string_view)
+{
+	AdventCheckMsg(false, "Server mode is only supported on POSIX systems");
+	return server_response{};
+}
+
+void advent::send_server_shutdown(const std::string&)
+{
+	AdventCheckMsg(false, "Server mode is only supported on POSIX systems");
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,175 @@
+#include "advent/advent_trace.h"
+
+#include <array>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+	struct trace_event
+	{
+		const char* name;
+		int64_t start_time;
+		int64_t end_time;
+	};
+
+	// Each thread writes to its own list of chunks, so recording never takes a lock. The owning thread
+	// publishes each event by bumping the chunk's count, which lets the writer read chunks safely.
+	struct event_chunk
+	{
+		static constexpr std::size_t capacity = 4096u;
+		std::array<trace_event, capacity> events;
+		std::atomic<std::size_t> count{ 0u };
+		std::atomic<event_chunk*> next{ nullptr };
+	};
+
+	struct thread_buffer
+	{
+		std::size_t thread_idx = 0u;
+		std::unique_ptr<event_chunk> first_chunk = std::make_unique<event_chunk>();
+		event_chunk* last_chunk = first_chunk.get();
+		std::vector<std::unique_ptr<event_chunk>> extra_chunks;
+
+		void push_back(const trace_event& evt)
+		{
+			std::size_t count = last_chunk->count.load(std::memory_order_relaxed);
+			if (count == event_chunk::capacity)
+			{
+				auto new_chunk = std::make_unique<event_chunk>();
+				event_chunk* const new_chunk_ptr = new_chunk.get();
+				extra_chunks.push_back(std::move(new_chunk));
+				last_chunk->next.store(new_chunk_ptr, std::memory_order_release);
+				last_chunk = new_chunk_ptr;
+				count = 0u;
+			}
+			last_chunk->events[count] = evt;
+			last_chunk->count.store(count + 1u, std::memory_order_release);
+		}
+	};
+
+	// Buffers are never freed, because worker threads (e.g. from std::execution::par_unseq) may exit before
+	// the trace is written.
+	struct buffer_registry
+	{
+		std::mutex mutex;
+		std::vector<std::unique_ptr<thread_buffer>> buffers;
+		std::string output_path;
+	};
+
+	buffer_registry& get_registry()
+	{
+		static buffer_registry registry;
+		return registry;
+	}
+
+	thread_buffer& get_thread_buffer()
+	{
+		thread_local thread_buffer* buffer = nullptr;
+		if (buffer == nullptr)
+		{
+			buffer_registry& registry = get_registry();
+			std::scoped_lock lock{ registry.mutex };
+			registry.buffers.push_back(std::make_unique<thread_buffer>());
+			buffer = registry.buffers.back().get();
+			buffer->thread_idx = registry.buffers.size();
+		}
+		return *buffer;
+	}
+
+	const std::chrono::steady_clock::time_point trace_epoch = std::chrono::steady_clock::now();
+
+	void write_json_string(std::ostream& output, std::string_view str)
+	{
+		output << '"';
+		for (char c : str)
+		{
+			if (c == '"' || c == '\\') output << '\\';
+			output << c;
+		}
+		output << '"';
+	}
+
+	void write_trace_at_exit()
+	{
+		buffer_registry& registry = get_registry();
+		std::ofstream output{ registry.output_path };
+		if (!output.is_open())
+		{
+			std::cerr << "ERROR: Could not open '" << registry.output_path << "' to write the trace.\n";
+			return;
+		}
+		advent::trace::write_chrome_trace(output);
+	}
+}
+
+int64_t advent::trace::internal::get_timestamp()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - trace_epoch).count();
+}
+
+void advent::trace::internal::record_event(const char* name, int64_t start_time, int64_t end_time)
+{
+	get_thread_buffer().push_back(trace_event{ name, start_time, end_time });
+}
+
+void advent::trace::set_enabled(bool enabled)
+{
+	internal::enabled_flag().store(enabled, std::memory_order_relaxed);
+}
+
+void advent::trace::write_at_exit(std::string output_path)
+{
+	buffer_registry& registry = get_registry();
+	{
+		std::scoped_lock lock{ registry.mutex };
+		const bool already_registered = !registry.output_path.empty();
+		registry.output_path = std::move(output_path);
+		if (!already_registered)
+		{
+			std::atexit(write_trace_at_exit);
+		}
+	}
+	set_enabled(true);
+}
+
+void advent::trace::write_chrome_trace(std::ostream& output)
+{
+	buffer_registry& registry = get_registry();
+	std::scoped_lock lock{ registry.mutex };
+
+	// Chrome wants microseconds. Fixed with three decimals keeps every nanosecond, where the default six significant
+	// digits would round anything after the first second.
+	auto to_us = [](int64_t ns) { return static_cast<double>(ns) / 1000.0; };
+	const std::ios_base::fmtflags old_flags = output.flags();
+	const std::streamsize old_precision = output.precision();
+	output << std::fixed << std::setprecision(3);
+
+	output << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+	bool first_event = true;
+	for (const std::unique_ptr<thread_buffer>& buffer : registry.buffers)
+	{
+		for (const event_chunk* chunk = buffer->first_chunk.get(); chunk != nullptr; chunk = chunk->next.load(std::memory_order_acquire))
+		{
+			const std::size_t count = chunk->count.load(std::memory_order_acquire);
+			for (std::size_t i = 0u; i < count; ++i)
+			{
+				const trace_event& evt = chunk->events[i];
+				output << (first_event ? "\n" : ",\n") << "{\"name\":";
+				write_json_string(output, evt.name);
+				output << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->thread_idx
+					<< ",\"ts\":" << to_us(evt.start_time)
+					<< ",\"dur\":" << to_us(evt.end_time - evt.start_time) << '}';
+				first_event = false;
+			}
+		}
+	}
+	output << "\n]}\n";
+	output.flags(old_flags);
+	output.precision(old_precision);
+}
\ No newline at end of file
@@ -0,0 +1,200 @@
+// Stand-alone benchmark for the utils containers, using the same timing harness as the per-day benchmarks.
+// Each workload is fixed, so numbers can be compared between builds.
+//
+// Usage: advent2024_bench_utils [ITERATIONS] [--filter NAME] [--warmup K] [--allocs] [--perf]
+
+#include "advent/advent_benchmark.h"
+#include "advent/advent_allocations.h"
+#include "advent/advent_platform.h"
+#include "advent/advent_assert.h"
+#include "advent/advent_command_line.h"
+
+#include "small_vector.h"
+#include "sorted_vector.h"
+#include "ring_buffer.h"
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include <cstdint>
+
+namespace
+{
+	constexpr std::size_t num_elements = 4096u;
+
+	// Cheap and deterministic, so every run sees the same keys.
+	struct key_sequence
+	{
+		uint32_t state = 12345u;
+		uint32_t next() noexcept
+		{
+			state = state * 1664525u + 1013904223u;
+			return state >> 8;
+		}
+	};
+
+	ResultType small_vector_push_back()
+	{
+		int64_t checksum = 0;
+		for (std::size_t round = 0u; round < 64u; ++round)
+		{
+			utils::small_vector<uint32_t, 32> values;
+			for (uint32_t i = 0u; i < num_elements / 64u; ++i)
+			{
+				values.push_back(i);
+			}
+			checksum += static_cast<int64_t>(values.size()) + values.back();
+		}
+		return checksum;
+	}
+
+	ResultType sorted_vector_insert_contains()
+	{
+		key_sequence keys;
+		utils::sorted_vector<uint32_t> values;
+		for (std::size_t i = 0u; i < num_elements; ++i)
+		{
+			values.insert(keys.next() % (num_elements * 2u));
+		}
+		int64_t num_found = 0;
+		for (uint32_t i = 0u; i < num_elements * 2u; ++i)
+		{
+			num_found += values.contains(i) ? 1 : 0;
+		}
+		return num_found;
+	}
+
+	ResultType flat_map_insert_find()
+	{
+		key_sequence keys;
+		utils::flat_map<uint32_t, int64_t> values;
+		for (std::size_t i = 0u; i < num_elements; ++i)
+		{
+			const uint32_t key = keys.next() % static_cast<uint32_t>(num_elements);
+			const auto find_result = values.find_by_key(key);
+			if (find_result != values.end())
+			{
+				++find_result->second;
+			}
+			else
+			{
+				values.insert_or_assign(key, int64_t{ 1 });
+			}
+		}
+		int64_t checksum = 0;
+		for (uint32_t i = 0u; i < num_elements; ++i)
+		{
+			const auto find_result = values.find_by_key(i);
+			checksum += find_result != values.end() ? find_result->second : 0;
+		}
+		return checksum;
+	}
+
+	ResultType ring_buffer_rotate()
+	{
+		utils::ring_buffer<uint32_t, 64> values;
+		values.fill(0u);
+		int64_t checksum = 0;
+		for (uint32_t i = 0u; i < num_elements * 4u; ++i)
+		{
+			values.rotate(1u);
+			values.back() = i;
+			checksum += values.front();
+		}
+		return checksum;
+	}
+
+	struct utils_workload
+	{
+		std::string_view name;
+		ResultType(*func)();
+	};
+
+	constexpr utils_workload workloads[] =
+	{
+		{ "small_vector_push_back", &small_vector_push_back },
+		{ "sorted_vector_insert_contains", &sorted_vector_insert_contains },
+		{ "flat_map_insert_find", &flat_map_insert_find },
+		{ "ring_buffer_rotate", &ring_buffer_rotate }
+	};
+
+	int print_usage(const char* program_name)
+	{
+		std::cerr << "Usage: " << program_name << " [ITERATIONS] [--filter NAME] [--warmup K] [--allocs] [--perf]\n";
+		return 1;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	std::cout.sync_with_stdio(false);
+
+	std::size_t num_repetitions = 100u;
+	std::size_t num_warmups = 5u;
+	std::string_view filter;
+	bool track_allocations = false;
+	bool hardware_counters = false;
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string_view arg{ argv[i] };
+		if (arg == "--filter" && i + 1 < argc)
+		{
+			filter = argv[++i];
+			continue;
+		}
+		if (arg == "--warmup" && i + 1 < argc)
+		{
+			const std::optional<std::size_t> parsed_warmups = advent::parse_command_line_value<std::size_t>(argv[++i]);
+			if (!parsed_warmups.has_value()) return print_usage(argv[0]);
+			num_warmups = *parsed_warmups;
+			continue;
+		}
+		if (arg == "--allocs")
+		{
+			track_allocations = true;
+			continue;
+		}
+		if (arg == "--perf")
+		{
+			hardware_counters = true;
+			continue;
+		}
+		const std::optional<std::size_t> parsed_repetitions = advent::parse_command_line_value<std::size_t>(arg);
+		if (!parsed_repetitions.has_value()) return print_usage(argv[0]);
+		num_repetitions = std::max(*parsed_repetitions, std::size_t{ 1u });
+	}
+
+	if (!advent::platform::pin_current_thread_to_core(advent::platform::get_benchmark_core()))
+	{
+		std::cout << "WARNING: Could not pin benchmark thread to a core. Results may be noisier.\n";
+	}
+	advent::allocations::set_tracking_enabled(track_allocations);
+
+	bool all_passed = true;
+	for (const utils_workload& workload : workloads)
+	{
+		if (!filter.empty() && !workload.name.contains(filter)) continue;
+		try
+		{
+			benchmark_counters counters{ track_allocations, hardware_counters };
+			const auto [res, stats] = benchmark_function(workload.func, num_warmups, num_repetitions);
+			const std::vector<test_counter> counter_values = counters.stop(num_warmups + num_repetitions);
+			std::cout << workload.name << ": " << to_string(res) << '\n';
+			std::cout << "    " << to_string(stats) << '\n';
+			if (!counter_values.empty())
+			{
+				std::cout << "    " << to_string(counter_values) << '\n';
+			}
+		}
+		catch (const advent::test_failed& tf)
+		{
+			std::cerr << workload.name << " FAILED: " << tf.what() << '\n';
+			all_passed = false;
+		}
+	}
+
+	advent::allocations::set_tracking_enabled(false);
+	advent::platform::unpin_current_thread();
+	return all_passed ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+#include "advent/advent_view_solvers.h"
+#include "advent/advent_headers.h"
+
+#include <array>
+#include <algorithm>
+
+namespace
+{
+	struct view_solver
+	{
+		int day;
+		advent::view_solver_func p1;
+		advent::view_solver_func p2;
+	};
+
+	constexpr std::array view_solvers
+	{
+		view_solver{ 1, advent_1::p1, advent_1::p2 },
+		view_solver{ 2, advent_2::p1, advent_2::p2 },
+		view_solver{ 3, advent_3::p1, advent_3::p2 },
+		view_solver{ 4, advent_4::p1, advent_4::p2 },
+		view_solver{ 5, advent_5::p1, advent_5::p2 },
+		view_solver{ 6, advent_6::p1, advent_6::p2 },
+		view_solver{ 7, advent_7::p1, advent_7::p2 },
+		view_solver{ 8, advent_8::p1, advent_8::p2 },
+		view_solver{ 9, advent_9::p1, advent_9::p2 },
+		view_solver{ 10, advent_10::p1, advent_10::p2 },
+		view_solver{ 11, advent_11::p1, advent_11::p2 },
+		view_solver{ 12, advent_12::p1, advent_12::p2 },
+		view_solver{ 13, advent_13::p1, advent_13::p2 },
+		view_solver{ 14, advent_14::p1, advent_14::p2 },
+		view_solver{ 15, advent_15::p1, advent_15::p2 },
+		view_solver{ 16, advent_16::p1, advent_16::p2 },
+		view_solver{ 17, advent_17::p1, advent_17::p2 },
+		view_solver{ 18, advent_18::p1, advent_18::p2 },
+		view_solver{ 19, advent_19::p1, advent_19::p2 },
+		view_solver{ 20, advent_20::p1, advent_20::p2 },
+		view_solver{ 21, advent_21::p1, advent_21::p2 },
+		view_solver{ 22, advent_22::p1, advent_22::p2 },
+		view_solver{ 23, advent_23::p1, advent_23::p2 },
+		view_solver{ 24, advent_24::p1, advent_24::p2 },
+		view_solver{ 25, advent_25::p1, advent_25::p2 },
+	};
+}
+
+advent::view_solver_func advent::get_view_solver(int day, int part)
+{
+	const auto solver_it = std::ranges::find(view_solvers, day, &view_solver::day);
+	if (solver_it == end(view_solvers)) return nullptr;
+	switch (part)
+	{
+	case 1:
+		return solver_it->p1;
+	case 2:
+		return solver_it->p2;
+	default:
+		return nullptr;
+	}
+}
\ No newline at end of file
@@ -6,9 +6,18 @@
 #include <concepts>
 #include <type_traits>
 #include <ranges>
+#include <unordered_map>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <bit>
+#include <cstdint>
 
 #include "advent/advent_assert.h"
+#include "advent/advent_cancellation.h"
 #include "swap_remove.h"
+#include "indexed_heap.h"
+#include "node_arena.h"
 
 #define ADVENT_A_STAR_USE_UTILS_SORTED_VECTOR 1
 #if ADVENT_A_STAR_USE_UTILS_SORTED_VECTOR
@@ -69,150 +78,643 @@ namespace utils
 			ns.insert(end(ns), std::move(new_val));
 		}
 #endif
-	}
 
-	// NodeType: An arbitrary node. No particular requirements. User provided functors are used to interact.
-	// IsEndPointFunc: A function bool f(Node) that returns true if the argument is an end-point.
-	// GetNextNodesFunc: Return any iterable type containing NodeTypes that can be reached from a NodeType argument.
-	// GetCostBetweenNodesFunc: Functor with the signature: CostType f(NodeType,NodeType).
-	// GetHeuristicForNode: Functor with CostType f(NodeType) to get the heuristic.
-	// AreNodesEqual: A function bool f(NodeType,NodeType) that returns true if both nodes are equal
-	// LogProgressFunc: A function void f(const NodeType& n, CostType cost, CostType cost_with_heuristic, std::size_t processed, std::size_t to_check, const NodeGetterFunc& get_nodes)
-	//		that is called every iteration. get_nodes() will build and return a std::vector<NodeType> of all nodes in the path so far.
-	template <
-		typename NodeType,
-		typename IsEndPointFunc,
-		typename GetNextNodesFunc,
-		typename GetCostBetweenNodesFunc,
-		typename GetHeuristicForNode,
-		typename AreNodesEqual,
-		typename LogProgressFunc>
-		auto a_star(
-			const NodeType& start_point,
-			const IsEndPointFunc& is_end_point,
-			const GetNextNodesFunc& get_next_nodes,
-			const GetCostBetweenNodesFunc& get_cost_between_nodes,
-			const GetHeuristicForNode& get_heuristic,
-			const AreNodesEqual& are_nodes_equal,
-			const LogProgressFunc& log_progress,
-			std::size_t estimated_number_of_nodes = 1)
-	{
-		using namespace a_star_internal;
-		using ID = std::size_t;
-		using CostType = decltype(get_cost_between_nodes(start_point, start_point));
-		struct AStarNode
+		template <typename NodeType, typename AreNodesEqual>
+		struct node_equal_ref
+		{
+			const AreNodesEqual* func;
+			bool operator()(const NodeType& l, const NodeType& r) const { return (*func)(l, r); }
+		};
+
+		template <typename NodeType, typename NodeHash>
+		struct node_hash_ref
+		{
+			const NodeHash* func;
+			std::size_t operator()(const NodeType& n) const { return static_cast<std::size_t>((*func)(n)); }
+		};
+
+		inline constexpr std::size_t no_node_id = std::numeric_limits<std::size_t>::max();
+
+		template <typename NodeType, typename CostType>
+		struct search_node
 		{
 			NodeType node;
 			CostType cost;
 			CostType with_heuristic;
-			ID id;
-			ID previous_id;
+			std::size_t previous_id;
+			bool checked;
 		};
 
-		struct SortById
+		template <typename NodeType, typename CostType>
+		using node_storage = utils::node_arena<search_node<NodeType, CostType>>;
+
+		// Follows the predecessor links back from last_id, then turns the result round so it starts at the start.
+		template <typename NodeType, typename CostType>
+		std::vector<NodeType> get_path(const node_storage<NodeType, CostType>& nodes, std::size_t last_id)
 		{
-			bool operator()(const AStarNode& l, const AStarNode& r) const noexcept { return l.id < r.id; }
-		};
+			std::vector<NodeType> result;
+			for (std::size_t id = last_id; id != no_node_id; id = nodes[id].previous_id)
+			{
+				result.push_back(nodes[id].node);
+			}
+			std::reverse(begin(result), end(result));
+			return result;
+		}
 
-		struct SortByHeuristic
+		// Every node seen gets an ID: its index in an arena, which never moves a node once it's there. An open
+		// addressing table of IDs, keyed on the node's hash, finds the ID of a node, so checking whether a neighbour
+		// has been seen is O(1).
+		// reset() keeps both the arena and the table, so a search that reuses a node_table doesn't allocate at all
+		// unless it sees more nodes than the searches before it.
+		template <typename NodeType, typename CostType>
+		class node_table
 		{
-			bool operator()(const AStarNode& l, const AStarNode& r) const noexcept { return l.with_heuristic > r.with_heuristic; }
+		public:
+			using ID = std::size_t;
+			using node_type = search_node<NodeType, CostType>;
+		private:
+			struct slot
+			{
+				ID id;
+				std::size_t hash;
+			};
+			static constexpr std::size_t min_num_slots = 16u;
+			node_storage<NodeType, CostType> m_nodes;
+			std::vector<slot> m_slots;
+			int m_shift = 0;
+
+			// Fibonacci hashing: the top bits of the product depend on every bit of the hash, so hashes that only
+			// differ in their low bits (like grid coordinates) still spread across the whole table.
+			std::size_t get_first_slot(std::size_t hash) const noexcept
+			{
+				return static_cast<std::size_t>((static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull) >> m_shift);
+			}
+
+			void set_num_slots(std::size_t num_slots)
+			{
+				m_slots.assign(num_slots, slot{ no_node_id, 0u });
+				m_shift = 64 - std::countr_zero(num_slots);
+			}
+
+			void grow()
+			{
+				std::vector<slot> old_slots = std::move(m_slots);
+				set_num_slots(std::max(min_num_slots, old_slots.size() * 2u));
+				const std::size_t mask = m_slots.size() - 1u;
+				for (const slot& s : old_slots)
+				{
+					if (s.id == no_node_id) continue;
+					std::size_t i = get_first_slot(s.hash);
+					while (m_slots[i].id != no_node_id)
+					{
+						i = (i + 1u) & mask;
+					}
+					m_slots[i] = s;
+				}
+			}
+		public:
+			// Forgets every node, keeping the memory.
+			void reset(std::size_t estimated_number_of_nodes)
+			{
+				m_nodes.reset();
+				m_nodes.reserve(estimated_number_of_nodes);
+				// Never more than half full.
+				const std::size_t num_slots = std::max({ min_num_slots, m_slots.size(), std::bit_ceil(estimated_number_of_nodes * 2u) });
+				set_num_slots(num_slots);
+			}
+
+			std::size_t size() const noexcept { return m_nodes.size(); }
+			node_type& operator[](ID id) { return m_nodes[id]; }
+			const node_type& operator[](ID id) const { return m_nodes[id]; }
+
+			// The ID of the node, or no_node_id if it hasn't been seen.
+			template <typename AreNodesEqual>
+			ID find(const NodeType& node, std::size_t hash, const AreNodesEqual& are_nodes_equal) const
+			{
+				if (m_slots.empty()) return no_node_id;
+				const std::size_t mask = m_slots.size() - 1u;
+				for (std::size_t i = get_first_slot(hash);; i = (i + 1u) & mask)
+				{
+					const slot& s = m_slots[i];
+					if (s.id == no_node_id) return no_node_id;
+					if (s.hash == hash && are_nodes_equal(m_nodes[s.id].node, node)) return s.id;
+				}
+			}
+
+			// MakeNodeFunc: node_type f(). Only called if the node hasn't been seen, and may move from 'node'.
+			// Returns the ID of the node, and whether it was added.
+			template <typename AreNodesEqual, typename MakeNodeFunc>
+			std::pair<ID, bool> find_or_add(const NodeType& node, std::size_t hash, const AreNodesEqual& are_nodes_equal, const MakeNodeFunc& make_node)
+			{
+				if ((m_nodes.size() + 1u) * 2u > m_slots.size())
+				{
+					grow();
+				}
+				const std::size_t mask = m_slots.size() - 1u;
+				for (std::size_t i = get_first_slot(hash);; i = (i + 1u) & mask)
+				{
+					slot& s = m_slots[i];
+					if (s.id == no_node_id)
+					{
+						const ID id = m_nodes.emplace_back(make_node());
+						s = slot{ id, hash };
+						return std::make_pair(id, true);
+					}
+					if (s.hash == hash && are_nodes_equal(m_nodes[s.id].node, node))
+					{
+						return std::make_pair(s.id, false);
+					}
+				}
+			}
+
+			std::vector<NodeType> get_path(ID last_id) const
+			{
+				return a_star_internal::get_path(m_nodes, last_id);
+			}
 		};
 
-		ID latest_id = 0;
-		NodeSet<AStarNode,SortById> checked_nodes;
+		// The open set is an indexed heap of IDs, so a shorter route to a node already waiting lowers its priority in
+		// place rather than adding a duplicate.
+		// Like the linear search, this assumes the heuristic is consistent: a node is never reopened once checked.
+		template <
+			typename NodeType,
+			typename IsEndPointFunc,
+			typename GetNextNodesFunc,
+			typename GetCostBetweenNodesFunc,
+			typename GetHeuristicForNode,
+			typename AreNodesEqual,
+			typename NodeHash,
+			typename LogProgressFunc,
+			typename CostType>
+		std::pair<std::vector<NodeType>, CostType> search_hashed(
+			const NodeType& start_point,
+			const IsEndPointFunc& is_end_point,
+			const GetNextNodesFunc& get_next_nodes,
+			const GetCostBetweenNodesFunc& get_cost_between_nodes,
+			const GetHeuristicForNode& get_heuristic,
+			const AreNodesEqual& are_nodes_equal,
+			const NodeHash& node_hash,
+			const LogProgressFunc& log_progress,
+			node_table<NodeType, CostType>& nodes,
+			utils::indexed_heap<CostType>& nodes_to_search,
+			std::size_t estimated_number_of_nodes)
+		{
+			using ID = std::size_t;
+			using AStarNode = search_node<NodeType, CostType>;
+			auto get_hash = [&node_hash](const NodeType& n) { return static_cast<std::size_t>(node_hash(n)); };
+
+			nodes.reset(estimated_number_of_nodes);
+			nodes_to_search.clear();
+			nodes_to_search.reserve(estimated_number_of_nodes);
+			std::size_t num_checked = 0u;
 
-		auto get_checked_node_by_id = [&checked_nodes](ID id) -> const AStarNode&
+			const CostType start_heuristic = get_heuristic(start_point);
+			const ID start_id = nodes.find_or_add(start_point, get_hash(start_point), are_nodes_equal,
+				[&]() { return AStarNode{ start_point, CostType{}, start_heuristic, no_node_id, false }; }).first;
+			nodes_to_search.push(start_id, start_heuristic);
+
+			while (!nodes_to_search.empty())
+			{
+				advent::throw_if_cancelled();
+				const ID current_id = nodes_to_search.pop();
+				// Nodes never move, so this stays valid while neighbours are added.
+				AStarNode& current = nodes[current_id];
+				current.checked = true;
+				++num_checked;
+
+				auto get_path = [&nodes, current_id]() { return nodes.get_path(current_id); };
+
+				log_progress(current.node, current.cost, current.with_heuristic, num_checked, nodes_to_search.size(), get_path);
+
+				if (is_end_point(current.node))
+				{
+					return std::make_pair(get_path(), current.cost);
+				}
+
+				auto next_nodes = get_next_nodes(current.node);
+				for (auto& n : next_nodes)
+				{
+					const CostType cost = current.cost + get_cost_between_nodes(current.node, n);
+					const auto [id, inserted] = nodes.find_or_add(n, get_hash(n), are_nodes_equal, [&]()
+						{
+							const CostType with_heuristic = cost + get_heuristic(n);
+							return AStarNode{ std::move(n), cost, with_heuristic, current_id, false };
+						});
+					if (inserted)
+					{
+						nodes_to_search.push(id, nodes[id].with_heuristic);
+						continue;
+					}
+
+					AStarNode& existing = nodes[id];
+					if (existing.checked || !(cost < existing.cost))
+					{
+						continue;
+					}
+					existing.cost = cost;
+					existing.with_heuristic = cost + get_heuristic(existing.node);
+					existing.previous_id = current_id;
+					nodes_to_search.decrease_key(id, existing.with_heuristic);
+				}
+			}
+
+			// If we run out of nodes, there's no path.
+			return std::make_pair(std::vector<NodeType>{}, CostType{});
+		}
+
+		template <typename NodeType>
+		concept std_hashable = requires(const NodeType& n)
 		{
-			AStarNode dummy;
-			dummy.id = id;
-			const auto find_result = checked_nodes.find(dummy);
-			AdventCheck(find_result != end(checked_nodes));
-			return *find_result;
+			{ std::hash<NodeType>{}(n) } -> std::convertible_to<std::size_t>;
 		};
 
-		NodeSet<AStarNode,SortByHeuristic> nodes_to_search;
-		reserve(nodes_to_search,estimated_number_of_nodes);
-		reserve(checked_nodes,estimated_number_of_nodes);
+		// Fallback for nodes without a hash: every new node is compared against every checked node.
+		template <
+			typename NodeType,
+			typename IsEndPointFunc,
+			typename GetNextNodesFunc,
+			typename GetCostBetweenNodesFunc,
+			typename GetHeuristicForNode,
+			typename AreNodesEqual,
+			typename LogProgressFunc>
+		auto search_linear(
+			const NodeType& start_point,
+			const IsEndPointFunc& is_end_point,
+			const GetNextNodesFunc& get_next_nodes,
+			const GetCostBetweenNodesFunc& get_cost_between_nodes,
+			const GetHeuristicForNode& get_heuristic,
+			const AreNodesEqual& are_nodes_equal,
+			const LogProgressFunc& log_progress,
+			std::size_t estimated_number_of_nodes)
+		{
+			using ID = std::size_t;
+			using CostType = decltype(get_cost_between_nodes(start_point, start_point));
+			using AStarNode = search_node<NodeType, CostType>;
+			struct OpenNode
+			{
+				CostType with_heuristic;
+				ID id;
+			};
 
-		nodes_to_search.insert(AStarNode{ start_point,0,0,++latest_id,0 });
+			struct SortByHeuristic
+			{
+				bool operator()(const OpenNode& l, const OpenNode& r) const noexcept { return l.with_heuristic > r.with_heuristic; }
+			};
 
-		while (!nodes_to_search.empty())
-		{
-#if ADVENT_A_STAR_DEBUG_SPAM
-			std::cout << "\nChecked nodes: ";
-			for (const AStarNode& node : checked_nodes)
+			node_storage<NodeType, CostType> nodes;
+			std::vector<ID> checked_ids;
+			NodeSet<OpenNode,SortByHeuristic> nodes_to_search;
+			nodes.reserve(estimated_number_of_nodes);
+			checked_ids.reserve(estimated_number_of_nodes);
+			reserve(nodes_to_search,estimated_number_of_nodes);
+
+			nodes_to_search.insert(OpenNode{ CostType{}, nodes.emplace_back(AStarNode{ start_point, CostType{}, CostType{}, no_node_id, false }) });
+
+			while (!nodes_to_search.empty())
 			{
-				std::cout << "\n    { " << node.id << ": " << node.cost << '[' << node.with_heuristic << "] " << node.node << " }";
+				advent::throw_if_cancelled();
+	#if ADVENT_A_STAR_DEBUG_SPAM
+				auto print_node = [&nodes](ID id)
+					{
+						const AStarNode& node = nodes[id];
+						std::cout << "\n    { " << id << ": " << node.cost << '[' << node.with_heuristic << "] " << node.node << " }";
+					};
+				std::cout << "\nChecked nodes: ";
+				for (ID id : checked_ids)
+				{
+					print_node(id);
+				}
+				std::cout << "\nUnchecked nodes: ";
+				for (const OpenNode& open_node : nodes_to_search)
+				{
+					print_node(open_node.id);
+				}
+	#endif
+				const ID current_id = get_last(nodes_to_search).id;
+				const AStarNode& current = nodes[current_id];
+
+				auto get_path = [&nodes, current_id]() { return a_star_internal::get_path(nodes, current_id); };
+
+				log_progress(current.node, current.cost, current.with_heuristic, checked_ids.size(), nodes_to_search.size(), get_path);
+
+				// Handle end-point
+				if (is_end_point(current.node))
+				{
+					return std::make_pair(get_path(), current.cost);
+				}
+
+				// Get next nodes
+				auto next_nodes = get_next_nodes(current.node);
+				for (auto& n : next_nodes)
+				{
+					const auto prev_node_check = std::any_of(begin(checked_ids), end(checked_ids),
+						[&n,&are_nodes_equal,&nodes](ID id)
+					{
+						return are_nodes_equal(n, nodes[id].node);
+					});
+					if (prev_node_check)
+					{
+						continue;
+					}
+					const CostType cost = current.cost + get_cost_between_nodes(current.node, n);
+					const CostType with_heuristic = cost + get_heuristic(n);
+					const ID id = nodes.emplace_back(AStarNode{ std::move(n), cost, with_heuristic, current_id, false });
+	#if ADVENT_A_STAR_DEBUG_SPAM
+					std::cout << "\nAdding node [ID:" << id << ";C:" << cost << ";H:" << with_heuristic << "] " << nodes[id].node << " to check.";
+	#endif
+					push_back(nodes_to_search, OpenNode{ with_heuristic, id });
+				}
+
+				// Update checked nodes
+				checked_ids.push_back(current_id);
 			}
-			std::cout << "\nUnchecked nodes: ";
-			for (const AStarNode& node : nodes_to_search)
+
+			// If we run out of nodes, there's no path.
+			return std::make_pair(std::vector<NodeType>{}, CostType{});
+		}
+
+		// Dijkstra from both ends at once. Each side keeps its own IDs, costs and open set. Whenever one side reaches
+		// a node the other side has seen, the two costs added together give a candidate path. The search can stop
+		// once the cheapest nodes left on the two sides cost more between them than the best candidate.
+		template <
+			typename NodeType,
+			typename GetNextNodesFunc,
+			typename GetPreviousNodesFunc,
+			typename GetCostBetweenNodesFunc,
+			typename AreNodesEqual,
+			typename NodeHash>
+		auto search_bidirectional(
+			const NodeType& start_point,
+			const NodeType& end_point,
+			const GetNextNodesFunc& get_next_nodes,
+			const GetPreviousNodesFunc& get_previous_nodes,
+			const GetCostBetweenNodesFunc& get_cost_between_nodes,
+			const AreNodesEqual& are_nodes_equal,
+			const NodeHash& node_hash,
+			std::size_t estimated_number_of_nodes)
+		{
+			using ID = std::size_t;
+			using CostType = decltype(get_cost_between_nodes(start_point, start_point));
+			using SearchNode = search_node<NodeType, CostType>;
+			auto get_hash = [&node_hash](const NodeType& n) { return static_cast<std::size_t>(node_hash(n)); };
+
+			struct Side
 			{
-				std::cout << "\n    { " << node.id << ": " << node.cost << '[' << node.with_heuristic << "] " << node.node << " }";
-			}
-#endif
-			AStarNode current_node = get_last(nodes_to_search);
+				node_table<NodeType, CostType> nodes;
+				utils::indexed_heap<CostType> nodes_to_search;
+			};
 
-			auto get_path = [&current_node,&get_checked_node_by_id]() -> std::vector<NodeType>
+			auto start_side = [&](Side& side, const NodeType& first_node)
 				{
-					AStarNode node = current_node;
-					std::vector<NodeType> result;
-					while (true)
+					side.nodes.reset(estimated_number_of_nodes);
+					side.nodes_to_search.reserve(estimated_number_of_nodes);
+					const ID first_id = side.nodes.find_or_add(first_node, get_hash(first_node), are_nodes_equal,
+						[&]() { return SearchNode{ first_node, CostType{}, CostType{}, no_node_id, false }; }).first;
+					side.nodes_to_search.push(first_id, CostType{});
+				};
+
+			Side forward;
+			Side backward;
+			start_side(forward, start_point);
+			start_side(backward, end_point);
+
+			bool found = are_nodes_equal(start_point, end_point);
+			CostType best_cost{};
+			ID forward_meeting_id = 0;
+			ID backward_meeting_id = 0;
+
+			auto expand = [&](Side& side, const Side& other, bool is_forward)
+				{
+					const ID current_id = side.nodes_to_search.pop();
+					SearchNode& current = side.nodes[current_id];
+					current.checked = true;
+
+					auto next_nodes = is_forward ? get_next_nodes(current.node) : get_previous_nodes(current.node);
+					for (auto& n : next_nodes)
 					{
-						result.push_back(std::move(node.node));
-						if (node.previous_id == 0)
+						const CostType cost = current.cost + (is_forward ? get_cost_between_nodes(current.node, n) : get_cost_between_nodes(n, current.node));
+						const std::size_t hash = get_hash(n);
+						const auto [id, inserted] = side.nodes.find_or_add(n, hash, are_nodes_equal,
+							[&]() { return SearchNode{ std::move(n), cost, cost, current_id, false }; });
+						if (inserted)
 						{
-							std::reverse(begin(result), end(result));
-							return result;
+							side.nodes_to_search.push(id, cost);
 						}
-						node = get_checked_node_by_id(node.previous_id);
+						else
+						{
+							SearchNode& existing = side.nodes[id];
+							if (existing.checked || !(cost < existing.cost)) continue;
+							existing.cost = cost;
+							existing.with_heuristic = cost;
+							existing.previous_id = current_id;
+							side.nodes_to_search.decrease_key(id, cost);
+						}
+
+						const ID other_id = other.nodes.find(side.nodes[id].node, hash, are_nodes_equal);
+						if (other_id == no_node_id) continue;
+						const CostType total_cost = cost + other.nodes[other_id].cost;
+						if (found && !(total_cost < best_cost)) continue;
+						found = true;
+						best_cost = total_cost;
+						forward_meeting_id = is_forward ? id : other_id;
+						backward_meeting_id = is_forward ? other_id : id;
 					}
 				};
 
-			log_progress(current_node.node, current_node.cost, current_node.with_heuristic, checked_nodes.size(), nodes_to_search.size(), get_path);
+			while (!forward.nodes_to_search.empty() && !backward.nodes_to_search.empty())
+			{
+				advent::throw_if_cancelled();
+				const CostType forward_top = forward.nodes_to_search.top_priority();
+				const CostType backward_top = backward.nodes_to_search.top_priority();
+				if (found && !(forward_top + backward_top < best_cost)) break;
+				// Expand whichever side has the cheaper frontier, which keeps the two searches about the same size.
+				if (!(backward_top < forward_top))
+				{
+					expand(forward, backward, true);
+				}
+				else
+				{
+					expand(backward, forward, false);
+				}
+			}
 
-			// Handle end-point
-			if (is_end_point(current_node.node))
+			if (!found)
 			{
-				std::vector<NodeType> result = get_path();
-				const auto final_cost = current_node.cost;
-				return std::make_pair(result, final_cost);
+				return std::make_pair(std::vector<NodeType>{}, CostType{});
 			}
 
-			// Get next nodes
-			auto next_nodes = get_next_nodes(current_node.node);
-			for (auto& n : next_nodes)
+			std::vector<NodeType> path = forward.nodes.get_path(forward_meeting_id);
+			for (ID id = backward.nodes[backward_meeting_id].previous_id; id != no_node_id; id = backward.nodes[id].previous_id)
 			{
-				const auto prev_node_check = std::any_of(begin(checked_nodes), end(checked_nodes),
-					[&n,&are_nodes_equal](const AStarNode& asn)
+				path.push_back(backward.nodes[id].node);
+			}
+			return std::make_pair(std::move(path), best_cost);
+		}
+
+		// Dijkstra that carries on until every target has been reached, or there's nowhere left to go.
+		template <
+			typename NodeType,
+			typename TargetRange,
+			typename GetNextNodesFunc,
+			typename GetCostBetweenNodesFunc,
+			typename AreNodesEqual,
+			typename NodeHash>
+		auto search_multi_target(
+			const NodeType& start_point,
+			const TargetRange& targets,
+			const GetNextNodesFunc& get_next_nodes,
+			const GetCostBetweenNodesFunc& get_cost_between_nodes,
+			const AreNodesEqual& are_nodes_equal,
+			const NodeHash& node_hash,
+			std::size_t estimated_number_of_nodes)
+		{
+			using ID = std::size_t;
+			using CostType = decltype(get_cost_between_nodes(start_point, start_point));
+			using PathAndCost = std::pair<std::vector<NodeType>, CostType>;
+			using SearchNode = search_node<NodeType, CostType>;
+			auto get_hash = [&node_hash](const NodeType& n) { return static_cast<std::size_t>(node_hash(n)); };
+
+			const node_hash_ref<NodeType, NodeHash> hash_ref{ &node_hash };
+			const node_equal_ref<NodeType, AreNodesEqual> equal_ref{ &are_nodes_equal };
+
+			// The same node can be asked for more than once, so map each one to every index it was asked for at.
+			std::vector<PathAndCost> result;
+			std::unordered_multimap<NodeType, std::size_t, node_hash_ref<NodeType, NodeHash>, node_equal_ref<NodeType, AreNodesEqual>> target_indices{ 1u, hash_ref, equal_ref };
+			for (const NodeType& target : targets)
+			{
+				target_indices.emplace(target, result.size());
+				result.emplace_back(std::vector<NodeType>{}, CostType{});
+			}
+			std::size_t num_targets_left = result.size();
+
+			node_table<NodeType, CostType> nodes;
+			utils::indexed_heap<CostType> nodes_to_search;
+			nodes.reset(estimated_number_of_nodes);
+			nodes_to_search.reserve(estimated_number_of_nodes);
+
+			const ID start_id = nodes.find_or_add(start_point, get_hash(start_point), are_nodes_equal,
+				[&]() { return SearchNode{ start_point, CostType{}, CostType{}, no_node_id, false }; }).first;
+			nodes_to_search.push(start_id, CostType{});
+
+			while (num_targets_left > 0u && !nodes_to_search.empty())
+			{
+				advent::throw_if_cancelled();
+				const ID current_id = nodes_to_search.pop();
+				SearchNode& current = nodes[current_id];
+				current.checked = true;
+
+				const auto [first_target, last_target] = target_indices.equal_range(current.node);
+				if (first_target != last_target)
 				{
-					return are_nodes_equal(n, asn.node);
-				});
-				if (prev_node_check)
+					const std::vector<NodeType> path = nodes.get_path(current_id);
+					for (auto it = first_target; it != last_target; ++it)
+					{
+						result[it->second] = PathAndCost{ path, current.cost };
+						--num_targets_left;
+					}
+				}
+
+				auto next_nodes = get_next_nodes(current.node);
+				for (auto& n : next_nodes)
 				{
-					continue;
+					const CostType cost = current.cost + get_cost_between_nodes(current.node, n);
+					const auto [id, inserted] = nodes.find_or_add(n, get_hash(n), are_nodes_equal,
+						[&]() { return SearchNode{ std::move(n), cost, cost, current_id, false }; });
+					if (inserted)
+					{
+						nodes_to_search.push(id, cost);
+						continue;
+					}
+					SearchNode& existing = nodes[id];
+					if (existing.checked || !(cost < existing.cost)) continue;
+					existing.cost = cost;
+					existing.with_heuristic = cost;
+					existing.previous_id = current_id;
+					nodes_to_search.decrease_key(id, cost);
 				}
-				AStarNode node;
-				node.cost = current_node.cost + get_cost_between_nodes(current_node.node, n);
-				node.with_heuristic = node.cost + get_heuristic(n);
-				node.node = std::move(n);
-				node.previous_id = current_node.id;
-				node.id = ++latest_id;
-#if ADVENT_A_STAR_DEBUG_SPAM
-				std::cout << "\nAdding node [ID:" << node.id << ";C:" << node.cost << ";H:" << node.with_heuristic << "] " << node.node << " to check.";
-#endif
-				nodes_to_search.push_back(std::move(node));
-				//auto new_it = nodes_to_search.insert(nodes_to_search.upper_bound(node), std::move(node));
-				
 			}
+			return result;
+		}
+	}
 
-			// Update checked nodes
-			push_back(checked_nodes,std::move(current_node));
+	// The memory behind a hashed a_star search, kept between searches. Every node goes in an arena that is reset
+	// rather than freed, and the open set and node lookup table keep their capacity, so running many searches through
+	// one workspace only allocates when a search sees more nodes than any before it.
+	// The functors are as for a_star, and so is the result. NodeHash is required.
+	template <typename NodeType, typename CostType>
+	class a_star_workspace
+	{
+		a_star_internal::node_table<NodeType, CostType> m_nodes;
+		utils::indexed_heap<CostType> m_nodes_to_search;
+	public:
+		template <
+			typename IsEndPointFunc,
+			typename GetNextNodesFunc,
+			typename GetCostBetweenNodesFunc,
+			typename GetHeuristicForNode,
+			typename AreNodesEqual,
+			typename NodeHash,
+			typename LogProgressFunc>
+			requires (std::invocable<const NodeHash&, const NodeType&> && !std::is_arithmetic_v<LogProgressFunc>)
+		std::pair<std::vector<NodeType>, CostType> search(
+			const NodeType& start_point,
+			const IsEndPointFunc& is_end_point,
+			const GetNextNodesFunc& get_next_nodes,
+			const GetCostBetweenNodesFunc& get_cost_between_nodes,
+			const GetHeuristicForNode& get_heuristic,
+			const AreNodesEqual& are_nodes_equal,
+			const NodeHash& node_hash,
+			const LogProgressFunc& log_progress,
+			std::size_t estimated_number_of_nodes = 1)
+		{
+			return a_star_internal::search_hashed(start_point, is_end_point, get_next_nodes, get_cost_between_nodes, get_heuristic, are_nodes_equal, node_hash, log_progress,
+				m_nodes, m_nodes_to_search, estimated_number_of_nodes);
 		}
 
-		// If we run out of nodes, there's no path.
-		return std::make_pair(std::vector<NodeType>{}, CostType{});
-	}
+		template <
+			typename IsEndPointFunc,
+			typename GetNextNodesFunc,
+			typename GetCostBetweenNodesFunc,
+			typename GetHeuristicForNode,
+			typename AreNodesEqual,
+			typename NodeHash>
+			requires std::invocable<const NodeHash&, const NodeType&>
+		std::pair<std::vector<NodeType>, CostType> search(
+			const NodeType& start_point,
+			const IsEndPointFunc& is_end_point,
+			const GetNextNodesFunc& get_next_nodes,
+			const GetCostBetweenNodesFunc& get_cost_between_nodes,
+			const GetHeuristicForNode& get_heuristic,
+			const AreNodesEqual& are_nodes_equal,
+			const NodeHash& node_hash,
+			std::size_t estimated_number_of_nodes = 1)
+		{
+			auto dummy_logger = [](const NodeType&, CostType, CostType, std::size_t, std::size_t, const auto&)
+				{
+				};
+			return search(start_point, is_end_point, get_next_nodes, get_cost_between_nodes, get_heuristic, are_nodes_equal, node_hash, dummy_logger, estimated_number_of_nodes);
+		}
+
+		// As above, using std::hash to look up nodes.
+		template <
+			typename IsEndPointFunc,
+			typename GetNextNodesFunc,
+			typename GetCostBetweenNodesFunc,
+			typename GetHeuristicForNode,
+			typename AreNodesEqual>
+			requires a_star_internal::std_hashable<NodeType>
+		std::pair<std::vector<NodeType>, CostType> search(
+			const NodeType& start_point,
+			const IsEndPointFunc& is_end_point,
+			const GetNextNodesFunc& get_next_nodes,
+			const GetCostBetweenNodesFunc& get_cost_between_nodes,
+			const GetHeuristicForNode& get_heuristic,
+			const AreNodesEqual& are_nodes_equal,
+			std::size_t estimated_number_of_nodes = 1)
+		{
+			return search(start_point, is_end_point, get_next_nodes, get_cost_between_nodes, get_heuristic, are_nodes_equal, std::hash<NodeType>{}, estimated_number_of_nodes);
+		}
+	};
 
 	// NodeType: An arbitrary node. No particular requirements. User provided functors are used to interact.
 	// IsEndPointFunc: A function bool f(Node) that returns true if the argument is an end-point.
@@ -220,6 +722,10 @@ namespace utils
 	// GetCostBetweenNodesFunc: Functor with the signature: CostType f(NodeType,NodeType).
 	// GetHeuristicForNode: Functor with CostType f(NodeType) to get the heuristic.
 	// AreNodesEqual: A function bool f(NodeType,NodeType) that returns true if both nodes are equal
+	// NodeHash: A function std::size_t f(NodeType) which gives equal nodes equal hashes.
+	// LogProgressFunc: A function void f(const NodeType& n, CostType cost, CostType cost_with_heuristic, std::size_t processed, std::size_t to_check, const NodeGetterFunc& get_nodes)
+	//		that is called every iteration. get_nodes() will build and return a std::vector<NodeType> of all nodes in the path so far.
+	// Looking up nodes by hash keeps large searches roughly linear in the number of nodes visited.
 	template <
 		typename NodeType,
 		typename IsEndPointFunc,
@@ -227,7 +733,9 @@ namespace utils
 		typename GetCostBetweenNodesFunc,
 		typename GetHeuristicForNode,
 		typename AreNodesEqual,
+		typename NodeHash,
 		typename LogProgressFunc>
+		requires (std::invocable<const NodeHash&, const NodeType&> && !std::is_arithmetic_v<LogProgressFunc>)
 	auto a_star(
 		const NodeType& start_point,
 		const IsEndPointFunc& is_end_point,
@@ -235,13 +743,193 @@ namespace utils
 		const GetCostBetweenNodesFunc& get_cost_between_nodes,
 		const GetHeuristicForNode& get_heuristic,
 		const AreNodesEqual& are_nodes_equal,
+		const NodeHash& node_hash,
+		const LogProgressFunc& log_progress,
 		std::size_t estimated_number_of_nodes = 1)
 	{
 		using CostType = decltype(get_cost_between_nodes(start_point, start_point));
-		auto dummy_logger = [](const NodeType& n, CostType cost, CostType cost_with_heuristic, std::size_t processed, std::size_t to_check, const auto& get_nodes)
-			{
+		a_star_workspace<NodeType, CostType> workspace;
+		return workspace.search(start_point, is_end_point, get_next_nodes, get_cost_between_nodes, get_heuristic, are_nodes_equal, node_hash, log_progress, estimated_number_of_nodes);
+	}
 
+	// As above, without logging.
+	template <
+		typename NodeType,
+		typename IsEndPointFunc,
+		typename GetNextNodesFunc,
+		typename GetCostBetweenNodesFunc,
+		typename GetHeuristicForNode,
+		typename AreNodesEqual,
+		typename NodeHash>
+		requires (std::invocable<const NodeHash&, const NodeType&> && !std::is_arithmetic_v<NodeHash>)
+	auto a_star(
+		const NodeType& start_point,
+		const IsEndPointFunc& is_end_point,
+		const GetNextNodesFunc& get_next_nodes,
+		const GetCostBetweenNodesFunc& get_cost_between_nodes,
+		const GetHeuristicForNode& get_heuristic,
+		const AreNodesEqual& are_nodes_equal,
+		const NodeHash& node_hash,
+		std::size_t estimated_number_of_nodes = 1)
+	{
+		using CostType = decltype(get_cost_between_nodes(start_point, start_point));
+		a_star_workspace<NodeType, CostType> workspace;
+		return workspace.search(start_point, is_end_point, get_next_nodes, get_cost_between_nodes, get_heuristic, are_nodes_equal, node_hash, estimated_number_of_nodes);
+	}
+
+	// As above, without a NodeHash. If std::hash works for NodeType it is used to look up nodes, together with
+	// are_nodes_equal, so the two must agree: nodes that are_nodes_equal says are equal need equal std::hash values.
+	// If they don't, pass a NodeHash that does. If there's no std::hash for NodeType, every newly found node is
+	// compared against every checked node, which gets slow for large searches: pass a NodeHash instead.
+	template <
+		typename NodeType,
+		typename IsEndPointFunc,
+		typename GetNextNodesFunc,
+		typename GetCostBetweenNodesFunc,
+		typename GetHeuristicForNode,
+		typename AreNodesEqual,
+		typename LogProgressFunc>
+		requires (!std::is_arithmetic_v<LogProgressFunc> && !std::invocable<const LogProgressFunc&, const NodeType&>)
+	auto a_star(
+		const NodeType& start_point,
+		const IsEndPointFunc& is_end_point,
+		const GetNextNodesFunc& get_next_nodes,
+		const GetCostBetweenNodesFunc& get_cost_between_nodes,
+		const GetHeuristicForNode& get_heuristic,
+		const AreNodesEqual& are_nodes_equal,
+		const LogProgressFunc& log_progress,
+		std::size_t estimated_number_of_nodes = 1)
+	{
+		if constexpr (a_star_internal::std_hashable<NodeType>)
+		{
+			using CostType = decltype(get_cost_between_nodes(start_point, start_point));
+			a_star_workspace<NodeType, CostType> workspace;
+			return workspace.search(start_point, is_end_point, get_next_nodes, get_cost_between_nodes, get_heuristic, are_nodes_equal, std::hash<NodeType>{}, log_progress, estimated_number_of_nodes);
+		}
+		else
+		{
+			return a_star_internal::search_linear(start_point, is_end_point, get_next_nodes, get_cost_between_nodes, get_heuristic, are_nodes_equal, log_progress, estimated_number_of_nodes);
+		}
+	}
+
+	// NodeType: An arbitrary node. No particular requirements. User provided functors are used to interact.
+	// IsEndPointFunc: A function bool f(Node) that returns true if the argument is an end-point.
+	// GetNextNodesFunc: Return any iterable type containing NodeTypes that can be reached from a NodeType argument.
+	// GetCostBetweenNodesFunc: Functor with the signature: CostType f(NodeType,NodeType).
+	// GetHeuristicForNode: Functor with CostType f(NodeType) to get the heuristic.
+	// AreNodesEqual: A function bool f(NodeType,NodeType) that returns true if both nodes are equal
+	template <
+		typename NodeType,
+		typename IsEndPointFunc,
+		typename GetNextNodesFunc,
+		typename GetCostBetweenNodesFunc,
+		typename GetHeuristicForNode,
+		typename AreNodesEqual>
+	auto a_star(
+		const NodeType& start_point,
+		const IsEndPointFunc& is_end_point,
+		const GetNextNodesFunc& get_next_nodes,
+		const GetCostBetweenNodesFunc& get_cost_between_nodes,
+		const GetHeuristicForNode& get_heuristic,
+		const AreNodesEqual& are_nodes_equal,
+		std::size_t estimated_number_of_nodes = 1)
+	{
+		using CostType = decltype(get_cost_between_nodes(start_point, start_point));
+		auto dummy_logger = [](const NodeType&, CostType, CostType, std::size_t, std::size_t, const auto&)
+			{
 			};
-		return a_star(start_point, is_end_point, get_next_nodes, get_cost_between_nodes, get_heuristic, are_nodes_equal, estimated_number_of_nodes, dummy_logger);
+		return a_star(start_point, is_end_point, get_next_nodes, get_cost_between_nodes, get_heuristic, are_nodes_equal, dummy_logger, estimated_number_of_nodes);
+	}
+
+	// Searches from both ends at once and meets in the middle, which explores roughly half as many nodes as searching
+	// from one end when there's a single known end point. There's no heuristic: it's a bidirectional Dijkstra.
+	// GetPreviousNodesFunc: Return any iterable type containing the NodeTypes from which the argument can be reached.
+	//		If every move can be reversed, this is the same as GetNextNodesFunc.
+	// The other functors are as for a_star. Costs must not be negative.
+	// Returns the path from start to end and its cost, or an empty path if there isn't one.
+	template <
+		typename NodeType,
+		typename GetNextNodesFunc,
+		typename GetPreviousNodesFunc,
+		typename GetCostBetweenNodesFunc,
+		typename AreNodesEqual,
+		typename NodeHash>
+		requires std::invocable<const NodeHash&, const NodeType&>
+	auto a_star_bidirectional(
+		const NodeType& start_point,
+		const NodeType& end_point,
+		const GetNextNodesFunc& get_next_nodes,
+		const GetPreviousNodesFunc& get_previous_nodes,
+		const GetCostBetweenNodesFunc& get_cost_between_nodes,
+		const AreNodesEqual& are_nodes_equal,
+		const NodeHash& node_hash,
+		std::size_t estimated_number_of_nodes = 1)
+	{
+		return a_star_internal::search_bidirectional(start_point, end_point, get_next_nodes, get_previous_nodes, get_cost_between_nodes, are_nodes_equal, node_hash, estimated_number_of_nodes);
+	}
+
+	// As above, using std::hash to look up nodes.
+	template <
+		typename NodeType,
+		typename GetNextNodesFunc,
+		typename GetPreviousNodesFunc,
+		typename GetCostBetweenNodesFunc,
+		typename AreNodesEqual>
+		requires a_star_internal::std_hashable<NodeType>
+	auto a_star_bidirectional(
+		const NodeType& start_point,
+		const NodeType& end_point,
+		const GetNextNodesFunc& get_next_nodes,
+		const GetPreviousNodesFunc& get_previous_nodes,
+		const GetCostBetweenNodesFunc& get_cost_between_nodes,
+		const AreNodesEqual& are_nodes_equal,
+		std::size_t estimated_number_of_nodes = 1)
+	{
+		return a_star_internal::search_bidirectional(start_point, end_point, get_next_nodes, get_previous_nodes, get_cost_between_nodes, are_nodes_equal, std::hash<NodeType>{}, estimated_number_of_nodes);
+	}
+
+	// Finds the cheapest path to each of several targets in one search, stopping once they have all been reached.
+	// There's no heuristic, because no one heuristic suits every target.
+	// TargetRange: Any iterable of NodeTypes.
+	// The other functors are as for a_star. Costs must not be negative.
+	// Returns a std::vector with a (path, cost) pair for each target, in the same order. Targets that can't be
+	// reached get an empty path.
+	template <
+		typename NodeType,
+		typename TargetRange,
+		typename GetNextNodesFunc,
+		typename GetCostBetweenNodesFunc,
+		typename AreNodesEqual,
+		typename NodeHash>
+		requires std::invocable<const NodeHash&, const NodeType&>
+	auto a_star_multi_target(
+		const NodeType& start_point,
+		const TargetRange& targets,
+		const GetNextNodesFunc& get_next_nodes,
+		const GetCostBetweenNodesFunc& get_cost_between_nodes,
+		const AreNodesEqual& are_nodes_equal,
+		const NodeHash& node_hash,
+		std::size_t estimated_number_of_nodes = 1)
+	{
+		return a_star_internal::search_multi_target(start_point, targets, get_next_nodes, get_cost_between_nodes, are_nodes_equal, node_hash, estimated_number_of_nodes);
+	}
+
+	// As above, using std::hash to look up nodes.
+	template <
+		typename NodeType,
+		typename TargetRange,
+		typename GetNextNodesFunc,
+		typename GetCostBetweenNodesFunc,
+		typename AreNodesEqual>
+		requires a_star_internal::std_hashable<NodeType>
+	auto a_star_multi_target(
+		const NodeType& start_point,
+		const TargetRange& targets,
+		const GetNextNodesFunc& get_next_nodes,
+		const GetCostBetweenNodesFunc& get_cost_between_nodes,
+		const AreNodesEqual& are_nodes_equal,
+		std::size_t estimated_number_of_nodes = 1)
+	{
+		return a_star_internal::search_multi_target(start_point, targets, get_next_nodes, get_cost_between_nodes, are_nodes_equal, std::hash<NodeType>{}, estimated_number_of_nodes);
 	}
 }
\ No newline at end of file
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <vector>
+#include <unordered_map>
+#include <concepts>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <algorithm>
+
+#include "advent/advent_assert.h"
+#include "advent/advent_cancellation.h"
+#include "a_star.h"
+
+namespace utils
+{
+	// A monotone priority queue for small integer priorities (Dial's algorithm).
+	// Every priority pushed must be between the last priority popped and that plus max_priority_step, which holds
+	// in Dijkstra's algorithm when edge costs are at most max_priority_step. Values are kept in a ring of
+	// max_priority_step + 1 buckets, so push is O(1) and pop is O(1) amortised.
+	// Values with equal priorities come out in no particular order.
+	template <typename ValueType, std::integral PriorityType = std::size_t>
+	class bucket_queue
+	{
+		std::vector<std::vector<ValueType>> m_buckets;
+		PriorityType m_current_priority{};
+		std::size_t m_size = 0u;
+
+		std::vector<ValueType>& bucket_for(PriorityType priority)
+		{
+			return m_buckets[static_cast<std::size_t>(priority) % m_buckets.size()];
+		}
+
+		void advance_to_next_value()
+		{
+			AdventCheck(!empty());
+			while (bucket_for(m_current_priority).empty())
+			{
+				++m_current_priority;
+			}
+		}
+	public:
+		explicit bucket_queue(std::size_t max_priority_step, PriorityType first_priority = PriorityType{})
+			: m_buckets(max_priority_step + 1u), m_current_priority{ first_priority }
+		{
+		}
+
+		bool empty() const noexcept { return m_size == 0u; }
+		std::size_t size() const noexcept { return m_size; }
+
+		void push(PriorityType priority, ValueType value)
+		{
+			AdventCheck(priority >= m_current_priority);
+			AdventCheck(static_cast<std::size_t>(priority - m_current_priority) < m_buckets.size());
+			bucket_for(priority).push_back(std::move(value));
+			++m_size;
+		}
+
+		PriorityType top_priority()
+		{
+			advance_to_next_value();
+			return m_current_priority;
+		}
+
+		// Removes one of the values with the lowest priority, and returns it with its priority.
+		std::pair<PriorityType, ValueType> pop()
+		{
+			advance_to_next_value();
+			std::vector<ValueType>& bucket = bucket_for(m_current_priority);
+			std::pair<PriorityType, ValueType> result{ m_current_priority, std::move(bucket.back()) };
+			bucket.pop_back();
+			--m_size;
+			return result;
+		}
+	};
+
+	// Dijkstra's algorithm for small non-negative integer edge costs, using a bucket_queue.
+	// Takes the same functors as utils::a_star, without the heuristic:
+	// NodeType: An arbitrary node. No particular requirements. User provided functors are used to interact.
+	// IsEndPointFunc: A function bool f(Node) that returns true if the argument is an end-point.
+	// GetNextNodesFunc: Return any iterable type containing NodeTypes that can be reached from a NodeType argument.
+	// GetCostBetweenNodesFunc: Functor with the signature: CostType f(NodeType,NodeType). CostType must be an integer,
+	//		and every cost must be between 0 and max_edge_cost.
+	// AreNodesEqual: A function bool f(NodeType,NodeType) that returns true if both nodes are equal
+	// NodeHash: A function std::size_t f(NodeType) which gives equal nodes equal hashes.
+	// Returns the path to the first end-point reached and its cost, or an empty path if there isn't one.
+	template <
+		typename NodeType,
+		typename IsEndPointFunc,
+		typename GetNextNodesFunc,
+		typename GetCostBetweenNodesFunc,
+		typename AreNodesEqual,
+		typename NodeHash>
+		requires std::invocable<const NodeHash&, const NodeType&>
+	auto bucket_dijkstra(
+		const NodeType& start_point,
+		const IsEndPointFunc& is_end_point,
+		const GetNextNodesFunc& get_next_nodes,
+		const GetCostBetweenNodesFunc& get_cost_between_nodes,
+		const AreNodesEqual& are_nodes_equal,
+		const NodeHash& node_hash,
+		std::size_t max_edge_cost,
+		std::size_t estimated_number_of_nodes = 1)
+	{
+		using ID = std::size_t;
+		using CostType = decltype(get_cost_between_nodes(start_point, start_point));
+		static_assert(std::is_integral_v<CostType>, "bucket_dijkstra needs integer costs");
+		constexpr ID no_previous_id = std::numeric_limits<ID>::max();
+		struct SearchNode
+		{
+			NodeType node;
+			CostType cost;
+			ID previous_id;
+			bool settled;
+		};
+
+		using IdMap = std::unordered_map<NodeType, ID, a_star_internal::node_hash_ref<NodeType, NodeHash>, a_star_internal::node_equal_ref<NodeType, AreNodesEqual>>;
+		IdMap node_ids{ estimated_number_of_nodes, a_star_internal::node_hash_ref<NodeType, NodeHash>{ &node_hash }, a_star_internal::node_equal_ref<NodeType, AreNodesEqual>{ &are_nodes_equal } };
+		std::vector<SearchNode> nodes;
+		nodes.reserve(estimated_number_of_nodes);
+
+		// Nodes are pushed again when a cheaper route is found, and the stale entries skipped when popped.
+		bucket_queue<ID, CostType> nodes_to_search{ max_edge_cost };
+		node_ids.emplace(start_point, ID{ 0 });
+		nodes.push_back(SearchNode{ start_point, CostType{}, no_previous_id, false });
+		nodes_to_search.push(CostType{}, ID{ 0 });
+
+		while (!nodes_to_search.empty())
+		{
+			advent::throw_if_cancelled();
+			const auto [current_cost, current_id] = nodes_to_search.pop();
+			if (nodes[current_id].settled || current_cost != nodes[current_id].cost) continue;
+			nodes[current_id].settled = true;
+
+			// Copied, because adding neighbours can reallocate the node array.
+			const NodeType current_node = nodes[current_id].node;
+			if (is_end_point(current_node))
+			{
+				std::vector<NodeType> path;
+				for (ID id = current_id; id != no_previous_id; id = nodes[id].previous_id)
+				{
+					path.push_back(nodes[id].node);
+				}
+				std::reverse(begin(path), end(path));
+				return std::make_pair(std::move(path), current_cost);
+			}
+
+			auto next_nodes = get_next_nodes(current_node);
+			for (auto& n : next_nodes)
+			{
+				const CostType edge_cost = get_cost_between_nodes(current_node, n);
+				AdventCheck(edge_cost >= CostType{ 0 } && static_cast<std::size_t>(edge_cost) <= max_edge_cost);
+				const CostType cost = current_cost + edge_cost;
+				const auto [id_it, inserted] = node_ids.try_emplace(n, nodes.size());
+				if (inserted)
+				{
+					nodes.push_back(SearchNode{ std::move(n), cost, current_id, false });
+				}
+				else
+				{
+					SearchNode& existing = nodes[id_it->second];
+					if (existing.settled || !(cost < existing.cost)) continue;
+					existing.cost = cost;
+					existing.previous_id = current_id;
+				}
+				nodes_to_search.push(cost, id_it->second);
+			}
+		}
+
+		// If we run out of nodes, there's no path.
+		return std::make_pair(std::vector<NodeType>{}, CostType{});
+	}
+
+	// As above, using std::hash to look up nodes.
+	template <
+		typename NodeType,
+		typename IsEndPointFunc,
+		typename GetNextNodesFunc,
+		typename GetCostBetweenNodesFunc,
+		typename AreNodesEqual>
+		requires a_star_internal::std_hashable<NodeType>
+	auto bucket_dijkstra(
+		const NodeType& start_point,
+		const IsEndPointFunc& is_end_point,
+		const GetNextNodesFunc& get_next_nodes,
+		const GetCostBetweenNodesFunc& get_cost_between_nodes,
+		const AreNodesEqual& are_nodes_equal,
+		std::size_t max_edge_cost,
+		std::size_t estimated_number_of_nodes = 1)
+	{
+		return bucket_dijkstra(start_point, is_end_point, get_next_nodes, get_cost_between_nodes, are_nodes_equal, std::hash<NodeType>{}, max_edge_cost, estimated_number_of_nodes);
+	}
+}
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include <cmath>
 #include <array>
 #include <iostream>
+#include <functional>
 
 #include "advent/advent_assert.h"
 #include "split_string.h"
@@ -401,3 +402,15 @@ namespace utils
 		return std::array<direction, 4>{ up, right, down, left };
 	}
 }
+
+template <typename T>
+struct std::hash<utils::basic_coords<T>>
+{
+	std::size_t operator()(const utils::basic_coords<T>& c) const noexcept
+	{
+		// Spread y into the high bits so nearby coordinates don't collide.
+		const std::size_t hx = std::hash<T>{}(c.x);
+		const std::size_t hy = std::hash<T>{}(c.y);
+		return hx ^ (hy * 0x9e3779b97f4a7c15ull);
+	}
+};
@@ -0,0 +1,233 @@
+#pragma once
+
+#include <vector>
+#include <span>
+#include <atomic>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+#include "advent/advent_assert.h"
+#include "advent/advent_cancellation.h"
+#include "coords.h"
+#include "grid.h"
+#include "thread_pool.h"
+
+namespace utils
+{
+	template <typename CostType>
+	inline constexpr CostType delta_stepping_unreachable = std::numeric_limits<CostType>::max();
+
+	// Delta-stepping (Meyer and Sanders) shortest paths from the start states to every state, with the work shared
+	// between threads. States go into buckets of width bucket_width by their distance so far, and every state in the
+	// lowest bucket is expanded at once, split across the threads, rather than one at a time as in Dijkstra's
+	// algorithm. Moves that land back in the same bucket get expanded again until the bucket stays empty, at which
+	// point everything in it is final.
+	// Narrow buckets waste the least work on states that later turn out to be cheaper; wide buckets give each step
+	// more to share out. Something around the typical move cost is a good start.
+	// ForEachMoveFunc: void f(state_id from, auto&& add_move). Calls add_move(state_id to, CostType cost) for
+	//		every move out of 'from'. Costs must not be negative. It gets called from several threads at once.
+	// A num_threads of 1 runs everything on the calling thread.
+	// Returns the distance to every state, indexed by state ID, with delta_stepping_unreachable for the rest.
+	template <typename CostType, typename ForEachMoveFunc>
+	std::vector<CostType> delta_stepping(std::size_t num_states, std::span<const std::size_t> start_states,
+		const ForEachMoveFunc& for_each_move, CostType bucket_width, std::size_t num_threads)
+	{
+		using state_id = std::size_t;
+		static_assert(std::atomic_ref<CostType>::is_always_lock_free);
+		constexpr CostType unreachable = delta_stepping_unreachable<CostType>;
+		// Below this many states per thread, handing the work out costs more than it saves.
+		constexpr std::size_t min_states_per_thread = 64u;
+		AdventCheck(CostType{} < bucket_width);
+		AdventCheck(num_threads > 0u);
+
+		std::vector<CostType> distances(num_states, unreachable);
+		// The distance each state was last expanded at, so duplicates in a bucket are only expanded once.
+		std::vector<CostType> expanded_at(num_states, unreachable);
+		// A ring of buckets, indexed by bucket number modulo its size. Moves only ever land between the current bucket
+		// and the one the most expensive move reaches, so it only needs about max_move_cost / bucket_width + 1
+		// buckets, however far the search goes. It grows whenever a move lands further ahead than that.
+		std::vector<std::vector<state_id>> buckets(1u);
+		std::size_t current_bucket_idx = 0u;
+		std::size_t num_queued = 0u;
+		auto get_bucket = [bucket_width](CostType cost)
+			{
+				const CostType bucket_idx = cost / bucket_width;
+				if constexpr (std::is_floating_point_v<CostType>)
+				{
+					// Also fails for NaN.
+					AdventCheckMsg(bucket_idx < static_cast<CostType>(std::numeric_limits<std::size_t>::max()),
+						"Distance ", cost, " is too many buckets of width ", bucket_width, " from the start");
+				}
+				return static_cast<std::size_t>(bucket_idx);
+			};
+		auto grow_buckets = [&buckets, &current_bucket_idx](std::size_t min_size)
+			{
+				std::vector<std::vector<state_id>> grown(std::max(min_size, 2u * buckets.size()));
+				for (std::size_t bucket_idx = current_bucket_idx; bucket_idx < current_bucket_idx + buckets.size(); ++bucket_idx)
+				{
+					grown[bucket_idx % grown.size()] = std::move(buckets[bucket_idx % buckets.size()]);
+				}
+				buckets = std::move(grown);
+			};
+		auto add_to_bucket = [&buckets, &current_bucket_idx, &num_queued, &distances, &get_bucket, &grow_buckets](state_id id)
+			{
+				const std::size_t bucket_idx = get_bucket(distances[id]);
+				AdventCheck(bucket_idx >= current_bucket_idx);
+				if (bucket_idx - current_bucket_idx >= buckets.size())
+				{
+					grow_buckets(bucket_idx - current_bucket_idx + 1u);
+				}
+				buckets[bucket_idx % buckets.size()].push_back(id);
+				++num_queued;
+			};
+
+		// Lowers the distance if this is cheaper. Returns whether it was.
+		auto relax = [&distances](state_id to, CostType cost)
+			{
+				std::atomic_ref<CostType> distance{ distances[to] };
+				CostType old_cost = distance.load(std::memory_order_relaxed);
+				while (cost < old_cost)
+				{
+					if (distance.compare_exchange_weak(old_cost, cost, std::memory_order_relaxed)) return true;
+				}
+				return false;
+			};
+
+		std::optional<utils::thread_pool> pool;
+		if (num_threads > 1u)
+		{
+			pool.emplace(num_threads);
+		}
+		// Each thread keeps its own list of the states it lowered, which get put in buckets once they're all done.
+		std::vector<std::vector<state_id>> lowered(num_threads);
+		std::vector<std::pair<state_id, CostType>> frontier;
+
+		auto expand = [&frontier, &for_each_move, &relax, num_states](std::size_t first, std::size_t last, std::vector<state_id>& lowered_states)
+			{
+				for (std::size_t i = first; i < last; ++i)
+				{
+					const auto [from, from_cost] = frontier[i];
+					for_each_move(from, [&relax, &lowered_states, from_cost, num_states](state_id to, CostType step_cost)
+						{
+							AdventCheck(to < num_states);
+							AdventCheck(!(step_cost < CostType{}));
+							if (relax(to, from_cost + step_cost))
+							{
+								lowered_states.push_back(to);
+							}
+						});
+				}
+			};
+
+		auto expand_frontier = [&]()
+			{
+				const std::size_t num_chunks = pool ? std::min(num_threads, frontier.size() / min_states_per_thread) : 0u;
+				if (num_chunks <= 1u)
+				{
+					expand(0u, frontier.size(), lowered.front());
+				}
+				else
+				{
+					const std::size_t chunk_size = (frontier.size() + num_chunks - 1u) / num_chunks;
+					for (std::size_t chunk = 0u; chunk < num_chunks; ++chunk)
+					{
+						const std::size_t first = chunk * chunk_size;
+						const std::size_t last = std::min(frontier.size(), first + chunk_size);
+						pool->submit([&expand, &lowered, first, last, chunk]() { expand(first, last, lowered[chunk]); });
+					}
+					pool->wait();
+				}
+
+				for (std::vector<state_id>& lowered_states : lowered)
+				{
+					for (state_id id : lowered_states)
+					{
+						add_to_bucket(id);
+					}
+					lowered_states.clear();
+				}
+			};
+
+		for (state_id start : start_states)
+		{
+			AdventCheck(start < num_states);
+			distances[start] = CostType{};
+			add_to_bucket(start);
+		}
+
+		std::vector<state_id> current_bucket;
+		for (; num_queued > 0u; ++current_bucket_idx)
+		{
+			advent::throw_if_cancelled();
+			while (!buckets[current_bucket_idx % buckets.size()].empty())
+			{
+				current_bucket.clear();
+				current_bucket.swap(buckets[current_bucket_idx % buckets.size()]);
+				num_queued -= current_bucket.size();
+				frontier.clear();
+				for (state_id id : current_bucket)
+				{
+					// States can be in the bucket more than once, or have got cheap enough since to be in an earlier one.
+					const CostType cost = distances[id];
+					if (get_bucket(cost) != current_bucket_idx || expanded_at[id] == cost) continue;
+					expanded_at[id] = cost;
+					frontier.emplace_back(id, cost);
+				}
+				expand_frontier();
+			}
+		}
+		return distances;
+	}
+
+	// Distances from the start cells to every cell of a grid.
+	// TraverseCostFunc: std::optional<CostType> f(utils::coords from, const NodeType&, utils::coords to, const NodeType&),
+	//		as for grid::get_path. All eight neighbours are offered, so it decides whether diagonals are allowed.
+	// Cells that can't be reached get delta_stepping_unreachable.
+	template <typename CostType, typename NodeType, typename TraverseCostFunc>
+	utils::grid<CostType> delta_stepping(const utils::grid<NodeType>& grid, std::span<const utils::coords> start_cells,
+		const TraverseCostFunc& traverse_cost_fn, CostType bucket_width, std::size_t num_threads)
+	{
+		const utils::coords size = grid.get_max_point();
+		const std::size_t width = static_cast<std::size_t>(size.x);
+		auto get_id = [width](const utils::coords& c) { return static_cast<std::size_t>(c.y) * width + static_cast<std::size_t>(c.x); };
+		auto get_location = [width](std::size_t id) { return utils::coords{ static_cast<int>(id % width), static_cast<int>(id / width) }; };
+
+		std::vector<std::size_t> start_states;
+		start_states.reserve(start_cells.size());
+		for (const utils::coords& start : start_cells)
+		{
+			AdventCheck(grid.is_on_grid(start));
+			start_states.push_back(get_id(start));
+		}
+
+		auto for_each_move = [&grid, &traverse_cost_fn, &get_id, &get_location](std::size_t from_id, auto&& add_move)
+			{
+				const utils::coords from = get_location(from_id);
+				const NodeType& from_node = grid[from];
+				for (const utils::coords& to : from.neighbours_plus_diag())
+				{
+					if (!grid.is_on_grid(to)) continue;
+					const auto cost = traverse_cost_fn(from, from_node, to, grid[to]);
+					if (cost.has_value())
+					{
+						add_move(get_id(to), static_cast<CostType>(*cost));
+					}
+				}
+			};
+
+		const std::size_t num_states = width * static_cast<std::size_t>(size.y);
+		const std::vector<CostType> distances = delta_stepping<CostType>(num_states, start_states, for_each_move, bucket_width, num_threads);
+
+		utils::grid<CostType> result;
+		result.resize(size, delta_stepping_unreachable<CostType>);
+		for (std::size_t id = 0u; id < num_states; ++id)
+		{
+			result[get_location(id)] = distances[id];
+		}
+		return result;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <vector>
+#include <numeric>
+#include <utility>
+#include <cstdint>
+
+#include "advent/advent_assert.h"
+
+namespace utils
+{
+	// Union-find over the elements 0 to size-1, with path compression and union by rank.
+	// Both unite and find are near enough O(1) amortised.
+	class disjoint_set
+	{
+		std::vector<std::size_t> m_parents;
+		std::vector<uint8_t> m_ranks;
+		std::size_t m_num_sets = 0u;
+	public:
+		explicit disjoint_set(std::size_t size = 0u) { reset(size); }
+
+		// Puts every element back in a set of its own.
+		void reset(std::size_t size)
+		{
+			m_parents.resize(size);
+			std::iota(begin(m_parents), end(m_parents), std::size_t{ 0u });
+			m_ranks.assign(size, uint8_t{ 0u });
+			m_num_sets = size;
+		}
+
+		std::size_t size() const noexcept { return m_parents.size(); }
+		std::size_t num_sets() const noexcept { return m_num_sets; }
+
+		// The representative of the element's set. Two elements are in the same set if they have the same one.
+		std::size_t find(std::size_t element)
+		{
+			AdventCheck(element < size());
+			// Path halving: point every other node on the way up at its grandparent.
+			while (m_parents[element] != element)
+			{
+				m_parents[element] = m_parents[m_parents[element]];
+				element = m_parents[element];
+			}
+			return element;
+		}
+
+		// Merges the sets containing both elements. Returns false if they were already in the same set.
+		bool unite(std::size_t a, std::size_t b)
+		{
+			std::size_t root_a = find(a);
+			std::size_t root_b = find(b);
+			if (root_a == root_b) return false;
+			if (m_ranks[root_a] < m_ranks[root_b])
+			{
+				std::swap(root_a, root_b);
+			}
+			m_parents[root_b] = root_a;
+			if (m_ranks[root_a] == m_ranks[root_b])
+			{
+				++m_ranks[root_a];
+			}
+			--m_num_sets;
+			return true;
+		}
+
+		bool connected(std::size_t a, std::size_t b) { return find(a) == find(b); }
+	};
+}
\ No newline at end of file
@@ -14,6 +14,8 @@
 #include "int_range.h"
 #include "small_vector.h"
 #include "range_contains.h"
+#include "grid_search.h"
+#include "jump_point_search.h"
 
 #define AOC_GRID_DEBUG_DEFAULT 0
 #if NDEBUG
@@ -223,7 +225,7 @@ namespace utils
 		template <typename NodeType = char>
 		auto build(std::string_view sv)
 		{
-			return result(sv, [](char c) {return static_cast<NodeType>(c); });
+			return build(sv, [](char c) {return static_cast<NodeType>(c); });
 		}
 
 		auto build(std::istream& iss, const auto& char_to_node_fn)
@@ -237,7 +239,7 @@ namespace utils
 		template <typename NodeType = char>
 		auto build(std::istream& iss)
 		{
-			return result(iss, [](char c) {return static_cast<NodeType>(c); });
+			return build(iss, [](char c) {return static_cast<NodeType>(c); });
 		}
 
 		template <typename NodeType>
@@ -291,6 +293,20 @@ namespace utils
 			}
 		};
 
+		// Lets get_path spot the default cost functor, where every step costs the same and nothing is blocked.
+		template <typename FnType>
+		struct default_cost_fn_traits
+		{
+			static constexpr bool is_default = false;
+		};
+
+		template <typename NodeType, bool allow_diagonal_init>
+		struct default_cost_fn_traits<DefaultCostFunctor<NodeType, allow_diagonal_init>>
+		{
+			static constexpr bool is_default = true;
+			static constexpr bool allow_diagonal = allow_diagonal_init;
+		};
+
 		template <typename T>
 		concept grid_type = requires { std::is_same_v<T,grid<typename T::value_type>> || std::is_same_v<T,const grid<typename T::value_type>>; };
 
@@ -537,148 +553,71 @@ inline utils::small_vector<utils::coords,1> utils::grid<NodeType>::get_path(cons
 
 	utils::small_vector<utils::coords,1> result;
 
-	struct SearchNode
-	{
-		int previous_node_id = -1;
-		utils::coords position;
-		float cost = 0.0f;
-		float cost_and_heuristic = 0.0f;
-	};
-
-	auto order_on_heuristic = [](const SearchNode& left, const SearchNode& right)
+	using cost_fn_traits = utils::grid_helpers::default_cost_fn_traits<std::remove_cvref_t<decltype(traverse_cost_fn)>>;
+	if constexpr (cost_fn_traits::is_default)
 	{
-		return left.cost_and_heuristic > right.cost_and_heuristic;
-	};
+		// Every step costs the same, so Jump Point Search finds an equally cheap path while expanding far fewer cells.
+		utils::jump_point_search<cost_fn_traits::allow_diagonal, float> search{ m_max_point };
+		const std::vector<utils::coords> path = search.find_path(start,
+			[](const utils::coords&) { return false; },
+			[this, &is_end_fn](const utils::coords& location) { return is_end_fn(location, at(location)); },
+			[this, &heuristic_fn](const utils::coords& location) { return heuristic_fn(location, at(location)); });
+		// The path goes from the end back to the start.
+		std::copy(path.rbegin(), path.rend(), std::back_inserter(result));
+		return result;
+	}
 
-	utils::small_vector<SearchNode,1> searched_nodes;
-	utils::small_vector<SearchNode,1> unsearched_nodes;
+	using search_type = utils::grid_search<float>;
+	using state_id = search_type::state_id;
+	search_type search{ m_max_point };
 
-	auto try_add_node = [this,&unsearched_nodes,&searched_nodes, &traverse_cost_fn, &heuristic_fn]
-		(int previous_node_id, const SearchNode& from, utils::coords to)
+	auto for_each_move = [this, &search, &traverse_cost_fn](state_id from_id, auto&& add_move)
 	{
-		if (!is_on_grid(to))
-		{
-#if AOC_GRID_DEBUG
-			std::cout << "    Skip adding node at " << to << ": Not on grid.\n";
-#endif
-			return;
-		}
-		const auto has_checked_result = std::find_if(begin(searched_nodes), end(searched_nodes), [this,&to](const SearchNode& node)
-			{
-				return node.position == to;
-			});
-		if (has_checked_result != end(searched_nodes))
-		{
-#if AOC_GRID_DEBUG
-			std::cout << "    Skip adding node at " << to << ": Already checked.\n";
-#endif
-			return;
-		}
-		SearchNode result;
-		result.previous_node_id = previous_node_id;
-		result.position = to;
-
-		const NodeType& to_node(at(to));
-		if (previous_node_id >= 0)
+		const utils::coords from = search.get_location(from_id);
+		const NodeType& from_node = at(from);
+		for (int dx : utils::int_range{ -1,2 })
 		{
-			const NodeType& from_node = at(from.position);
-			const std::optional<float> latest_cost_opt = traverse_cost_fn(from.position, from_node, to, to_node);
-			if (!latest_cost_opt.has_value())
+			for (int dy : utils::int_range{ -1,2 })
 			{
-#if AOC_GRID_DEBUG
-				std::cout << "    Skip adding node at " << to << ": Cannot traverse.\n";
-#endif
-				return;
+				if (dx == 0 && dy == 0) continue;
+				const utils::coords to = from + utils::coords{ dx,dy };
+				if (!is_on_grid(to)) continue;
+				const std::optional<float> cost = traverse_cost_fn(from, from_node, to, at(to));
+				if (cost.has_value())
+				{
+					add_move(search.get_id(to), *cost);
+				}
 			}
-			const float latest_cost = *latest_cost_opt;
-			result.cost = from.cost + latest_cost;
 		}
-		else
-		{
-			result.cost = 0.0f;
-		}
-		const float heuristic = heuristic_fn(to, to_node);
-		result.cost_and_heuristic = result.cost + heuristic;
-#if AOC_GRID_DEBUG
-		std::cout << "    Adding node to search: Loc="
-			<< result.position << " C=" << result.cost << " H=" << result.cost_and_heuristic << '\n';
-#endif
-		unsearched_nodes.push_back(result);
 	};
 
+	auto is_end = [this, &search, &is_end_fn](state_id id)
 	{
-		SearchNode first_node;
-		first_node.position = start;
-		try_add_node(-1, SearchNode{}, start);
-	}
+		const utils::coords location = search.get_location(id);
+		return is_end_fn(location, at(location));
+	};
 
-	while (!unsearched_nodes.empty())
+	auto heuristic = [this, &search, &heuristic_fn](state_id id)
 	{
-#if AOC_GRID_DEBUG
-		std::cout << "Searched nodes: " << searched_nodes.size() << " Unsearched nodes: " << unsearched_nodes.size() << '\n';
-#endif
-		const SearchNode next_node = unsearched_nodes.back();
-#if AOC_GRID_DEBUG
-		std::cout << "Expanding node: " << next_node.position << " with cost=" << next_node.cost
-			<< " heuristic=" << next_node.cost_and_heuristic << '\n';
-#endif
-		unsearched_nodes.pop_back();
+		const utils::coords location = search.get_location(id);
+		return heuristic_fn(location, at(location));
+	};
 
-		{
-			const auto already_checked_result = std::find_if(begin(searched_nodes), end(searched_nodes),
-				[&next_node](const SearchNode& previous_node)
-				{
-					return next_node.position == previous_node.position;
-				});
-			if (already_checked_result != end(searched_nodes))
-			{
-#if AOC_GRID_DEBUG
-				std::cout << "    Skipping node " << next_node.position << ": already searched here.\n";
-#endif
-				continue;
-			}
-		}
+	const state_id start_id = search.get_id(start);
+	const state_id end_id = search.run(std::span<const state_id>{ &start_id, 1u }, for_each_move, is_end, heuristic);
+	if (end_id == search_type::no_state)
+	{
+		return result;
+	}
 
-		const bool node_is_end = is_end_fn(next_node.position,at(next_node.position));
-		if (node_is_end)
-		{
-			SearchNode path_node = next_node;
-			while(true)
-			{
-				result.push_back(path_node.position);
-				if (path_node.previous_node_id < 0)
-				{
-					break;
-				}
-				else
-				{
-					const std::size_t previous_idx = static_cast<std::size_t>(path_node.previous_node_id);
-					AdventCheck(previous_idx < searched_nodes.size());
-					path_node = searched_nodes[previous_idx];
-				}
-			}
+	// The path goes from the end back to the start.
+	for (state_id id = end_id; id != search_type::no_state; id = search.get_previous(id))
+	{
+		result.push_back(search.get_location(id));
+	}
 #if AOC_GRID_DEBUG
-			std::cout << "Found target node: " << next_node.position << " Total path len=" << result.size() << '\n';
+	std::cout << "Found target node: " << result.front() << " Total path len=" << result.size() << '\n';
 #endif
-			break;
-		}
-
-		const int previous_id = static_cast<int>(searched_nodes.size());
-		for (int dx : utils::int_range{ -1,2 })
-		{
-			for (int dy : utils::int_range{ -1,2 })
-			{
-				if (dx == 0 && dy == 0) continue;
-				const utils::coords delta_pos{ dx,dy };
-				const utils::coords next_coords = next_node.position + delta_pos;
-				try_add_node(previous_id, next_node, next_coords);
-			}
-		}
-
-		std::sort(begin(unsearched_nodes), end(unsearched_nodes), order_on_heuristic);
-		searched_nodes.push_back(next_node);
-	}
-
 	return result;
 }
 
@@ -695,7 +634,7 @@ inline utils::small_vector<utils::coords,1> utils::grid<NodeType>::get_path(cons
 	}
 	if constexpr (is_heuristic_fn)
 	{
-		auto cost_fn = utils::grid_helpers::DefaultCostFunctor<false>{};
+		auto cost_fn = utils::grid_helpers::DefaultCostFunctor<NodeType,false>{};
 		return get_path(start, is_end_fn, cost_fn, cost_or_heuristic_fn);
 	}
 	AdventUnreachable();
@@ -705,7 +644,7 @@ inline utils::small_vector<utils::coords,1> utils::grid<NodeType>::get_path(cons
 template<typename NodeType>
 inline utils::small_vector<utils::coords,1> utils::grid<NodeType>::get_path(const utils::coords& start, const auto& is_end_fn) const
 {
-	return get_path(start, is_end_fn, utils::grid_helpers::DefaultCostFunctor<false>{}, utils::grid_helpers::DefaultHeuristicFunctor<NodeType>{});
+	return get_path(start, is_end_fn, utils::grid_helpers::DefaultCostFunctor<NodeType,false>{}, utils::grid_helpers::DefaultHeuristicFunctor<NodeType>{});
 }
 
 template<typename NodeType>
@@ -731,7 +670,7 @@ inline utils::small_vector<utils::coords,1> utils::grid<NodeType>::get_path(cons
 	}
 	if constexpr (is_heuristic_fn)
 	{
-		auto cost_fn = utils::grid_helpers::DefaultCostFunctor<false>{};
+		auto cost_fn = utils::grid_helpers::DefaultCostFunctor<NodeType,false>{};
 		return get_path(start, end, cost_fn, cost_or_heuristic_fn);
 	}
 	AdventUnreachable();
@@ -741,7 +680,7 @@ inline utils::small_vector<utils::coords,1> utils::grid<NodeType>::get_path(cons
 template<typename NodeType>
 inline utils::small_vector<utils::coords,1> utils::grid<NodeType>::get_path(const utils::coords& start, const utils::coords& end) const
 {
-	return get_path(start, end, utils::grid_helpers::DefaultCostFunctor{}, utils::grid_helpers::DefaultHeuristicFunctor<NodeType>{ end });
+	return get_path(start, end, utils::grid_helpers::DefaultCostFunctor<NodeType,false>{}, utils::grid_helpers::DefaultHeuristicFunctor<NodeType>{ end });
 }
 
 template<typename NodeType>
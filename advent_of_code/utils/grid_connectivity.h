@@ -0,0 +1,153 @@
+#pragma once
+
+#include <vector>
+#include <span>
+#include <cstdint>
+#include <limits>
+
+#include "advent/advent_assert.h"
+#include "coords.h"
+#include "coords_iterators.h"
+#include "grid.h"
+#include "disjoint_set.h"
+
+namespace utils
+{
+	enum class grid_adjacency : char
+	{
+		orthogonal,
+		with_diagonals
+	};
+
+	// What find_first_disconnecting_insertion found.
+	struct grid_disconnection
+	{
+		enum class outcome : char
+		{
+			never_disconnected,
+			disconnected_at,
+			initially_disconnected
+		};
+
+		outcome result = outcome::never_disconnected;
+
+		// The insertion that cut start off from finish. Only meaningful when result is disconnected_at.
+		std::size_t insertion_idx = 0u;
+
+		static constexpr grid_disconnection never_disconnected() noexcept { return grid_disconnection{}; }
+		static constexpr grid_disconnection disconnected_at(std::size_t idx) noexcept { return grid_disconnection{ outcome::disconnected_at, idx }; }
+		static constexpr grid_disconnection initially_disconnected() noexcept { return grid_disconnection{ outcome::initially_disconnected }; }
+
+		bool operator==(const grid_disconnection&) const noexcept = default;
+	};
+
+	// Cells get blocked one at a time, in the order given by 'insertions'. Finds the first insertion after which there
+	// is no longer a route from start to finish through open cells, if there is one. There's no insertion to report
+	// when there's no route even before anything is blocked, so that's an outcome of its own.
+	// is_initially_blocked(utils::coords) says which cells are blocked before any insertions.
+	// Works backwards: blocks everything, then reopens the cells in reverse order, joining each one to its open
+	// neighbours in a disjoint_set until start and finish are in the same set. That makes it near enough linear in
+	// the size of the grid plus the number of insertions, with no searching at all.
+	template <typename IsInitiallyBlockedFunc>
+	grid_disconnection find_first_disconnecting_insertion(utils::coords grid_size, utils::coords start, utils::coords finish,
+		std::span<const utils::coords> insertions, grid_adjacency adjacency, const IsInitiallyBlockedFunc& is_initially_blocked)
+	{
+		AdventCheck(grid_size.x > 0 && grid_size.y > 0);
+		const std::size_t width = static_cast<std::size_t>(grid_size.x);
+		const std::size_t num_cells = width * static_cast<std::size_t>(grid_size.y);
+		auto is_on_grid = [&grid_size](const utils::coords& c)
+			{
+				return c.x >= 0 && c.y >= 0 && c.x < grid_size.x && c.y < grid_size.y;
+			};
+		auto get_id = [width](const utils::coords& c)
+			{
+				return static_cast<std::size_t>(c.y) * width + static_cast<std::size_t>(c.x);
+			};
+		AdventCheck(is_on_grid(start));
+		AdventCheck(is_on_grid(finish));
+
+		// Count insertions per cell, because the same cell can be blocked more than once.
+		std::vector<uint32_t> num_blocks(num_cells, 0u);
+		for (const utils::coords& c : insertions)
+		{
+			AdventCheck(is_on_grid(c));
+			++num_blocks[get_id(c)];
+		}
+		for (const utils::coords& c : utils::coords_iterators::elem_range{ grid_size })
+		{
+			if (is_initially_blocked(c))
+			{
+				// Never reopened.
+				num_blocks[get_id(c)] = std::numeric_limits<uint32_t>::max();
+			}
+		}
+
+		disjoint_set cells{ num_cells };
+		auto join_open_neighbours = [&](const utils::coords& c)
+			{
+				const std::size_t id = get_id(c);
+				auto try_join = [&](const utils::coords& neighbour)
+					{
+						if (is_on_grid(neighbour) && num_blocks[get_id(neighbour)] == 0u)
+						{
+							cells.unite(id, get_id(neighbour));
+						}
+					};
+				if (adjacency == grid_adjacency::with_diagonals)
+				{
+					for (const utils::coords& neighbour : c.neighbours_plus_diag()) try_join(neighbour);
+				}
+				else
+				{
+					for (const utils::coords& neighbour : c.neighbours()) try_join(neighbour);
+				}
+			};
+
+		// The grid as it is after every insertion.
+		for (const utils::coords& c : utils::coords_iterators::elem_range{ grid_size })
+		{
+			if (num_blocks[get_id(c)] == 0u)
+			{
+				join_open_neighbours(c);
+			}
+		}
+
+		const std::size_t start_id = get_id(start);
+		const std::size_t finish_id = get_id(finish);
+		auto is_connected = [&]()
+			{
+				return num_blocks[start_id] == 0u && num_blocks[finish_id] == 0u && cells.connected(start_id, finish_id);
+			};
+		if (is_connected()) return grid_disconnection::never_disconnected();
+
+		// Undo the insertions from the last one back.
+		for (std::size_t i = insertions.size(); i-- > 0u;)
+		{
+			const utils::coords& c = insertions[i];
+			uint32_t& count = num_blocks[get_id(c)];
+			if (count == std::numeric_limits<uint32_t>::max()) continue;
+			AdventCheck(count > 0u);
+			if (--count > 0u) continue;
+			join_open_neighbours(c);
+			if (is_connected()) return grid_disconnection::disconnected_at(i);
+		}
+
+		// Never connected, even before the first insertion. That's true with no insertions at all, too.
+		return grid_disconnection::initially_disconnected();
+	}
+
+	inline grid_disconnection find_first_disconnecting_insertion(utils::coords grid_size, utils::coords start, utils::coords finish,
+		std::span<const utils::coords> insertions, grid_adjacency adjacency = grid_adjacency::orthogonal)
+	{
+		return find_first_disconnecting_insertion(grid_size, start, finish, insertions, adjacency, [](const utils::coords&) { return false; });
+	}
+
+	// As above, where the cells for which is_blocked(utils::coords, NodeType) returns true are blocked from the start.
+	template <typename NodeType, typename IsBlockedFunc>
+	grid_disconnection find_first_disconnecting_insertion(const utils::grid<NodeType>& grid, const IsBlockedFunc& is_blocked,
+		utils::coords start, utils::coords finish, std::span<const utils::coords> insertions, grid_adjacency adjacency = grid_adjacency::orthogonal)
+	{
+		return find_first_disconnecting_insertion(grid.get_max_point(), start, finish, insertions, adjacency,
+			[&grid, &is_blocked](const utils::coords& c) { return is_blocked(c, grid[c]); });
+	}
+}
\ No newline at end of file
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <vector>
+#include <span>
+#include <limits>
+#include <algorithm>
+#include <cstdint>
+
+#include "advent/advent_assert.h"
+#include "advent/advent_cancellation.h"
+#include "coords.h"
+#include "indexed_heap.h"
+
+namespace utils
+{
+	// Shortest paths over the dense state space of a grid: every cell, times a fixed number of layers per cell
+	// (e.g. 4 if it matters which way you're facing). Costs and predecessors live in flat arrays indexed by state ID
+	// instead of per-node objects, so a search never allocates per node and never looks nodes up. Reusing the same
+	// grid_search for several searches reuses the arrays too.
+	// State IDs are (y * width + x) * num_layers + layer.
+	template <typename CostType = int64_t>
+	class grid_search
+	{
+	public:
+		using state_id = std::size_t;
+		static constexpr state_id no_state = std::numeric_limits<state_id>::max();
+		static constexpr CostType unreachable = std::numeric_limits<CostType>::max();
+	private:
+		utils::coords m_size;
+		std::size_t m_num_layers = 1u;
+		std::vector<CostType> m_costs;
+		std::vector<state_id> m_previous;
+		indexed_heap<CostType> m_open;
+
+		void reset()
+		{
+			std::ranges::fill(m_costs, unreachable);
+			std::ranges::fill(m_previous, no_state);
+			m_open.clear();
+		}
+	public:
+		explicit grid_search(utils::coords grid_size, std::size_t num_layers = 1u)
+			: m_size{ grid_size }, m_num_layers{ num_layers }
+		{
+			AdventCheck(grid_size.x >= 0 && grid_size.y >= 0);
+			AdventCheck(num_layers > 0u);
+			const std::size_t num_states = static_cast<std::size_t>(grid_size.x) * static_cast<std::size_t>(grid_size.y) * num_layers;
+			m_costs.resize(num_states, unreachable);
+			m_previous.resize(num_states, no_state);
+			m_open.reserve(num_states);
+		}
+
+		std::size_t num_states() const noexcept { return m_costs.size(); }
+		std::size_t num_layers() const noexcept { return m_num_layers; }
+		utils::coords get_size() const noexcept { return m_size; }
+
+		bool is_on_grid(utils::coords location) const noexcept
+		{
+			return location.x >= 0 && location.y >= 0 && location.x < m_size.x && location.y < m_size.y;
+		}
+
+		state_id get_id(utils::coords location, std::size_t layer = 0u) const
+		{
+			AdventCheck(is_on_grid(location));
+			AdventCheck(layer < m_num_layers);
+			const std::size_t cell = static_cast<std::size_t>(location.y) * static_cast<std::size_t>(m_size.x) + static_cast<std::size_t>(location.x);
+			return cell * m_num_layers + layer;
+		}
+
+		utils::coords get_location(state_id id) const
+		{
+			AdventCheck(id < num_states());
+			const std::size_t cell = id / m_num_layers;
+			const std::size_t width = static_cast<std::size_t>(m_size.x);
+			return utils::coords{ static_cast<int>(cell % width), static_cast<int>(cell / width) };
+		}
+
+		std::size_t get_layer(state_id id) const
+		{
+			AdventCheck(id < num_states());
+			return id % m_num_layers;
+		}
+
+		// Runs Dijkstra's algorithm from all the start states at once, or A* if there is a heuristic.
+		// ForEachMoveFunc: void f(state_id from, auto&& add_move). Calls add_move(state_id to, CostType cost) for
+		//		every move out of 'from'. Costs must not be negative.
+		// IsEndFunc: bool f(state_id). The search stops at the first end state it reaches.
+		// HeuristicFunc: CostType f(state_id). Must never overestimate the remaining cost.
+		// Returns the end state reached, or no_state. Either way, costs and paths to every state reached so far can be
+		// read back afterwards.
+		template <typename ForEachMoveFunc, typename IsEndFunc, typename HeuristicFunc>
+		state_id run(std::span<const state_id> start_states, const ForEachMoveFunc& for_each_move, const IsEndFunc& is_end, const HeuristicFunc& heuristic)
+		{
+			reset();
+			for (state_id start : start_states)
+			{
+				AdventCheck(start < num_states());
+				m_costs[start] = CostType{};
+				m_open.push_or_decrease(start, heuristic(start));
+			}
+
+			while (!m_open.empty())
+			{
+				advent::throw_if_cancelled();
+				const state_id current = m_open.pop();
+				if (is_end(current)) return current;
+
+				const CostType current_cost = m_costs[current];
+				for_each_move(current, [this, current, current_cost, &heuristic](state_id next, CostType step_cost)
+					{
+						AdventCheck(next < num_states());
+						AdventCheck(step_cost >= CostType{});
+						const CostType cost = current_cost + step_cost;
+						if (!(cost < m_costs[next])) return;
+						m_costs[next] = cost;
+						m_previous[next] = current;
+						m_open.push_or_decrease(next, cost + heuristic(next));
+					});
+			}
+			return no_state;
+		}
+
+		template <typename ForEachMoveFunc, typename IsEndFunc>
+		state_id run(std::span<const state_id> start_states, const ForEachMoveFunc& for_each_move, const IsEndFunc& is_end)
+		{
+			return run(start_states, for_each_move, is_end, [](state_id) { return CostType{}; });
+		}
+
+		template <typename ForEachMoveFunc, typename IsEndFunc>
+		state_id run(state_id start, const ForEachMoveFunc& for_each_move, const IsEndFunc& is_end)
+		{
+			return run(std::span<const state_id>{ &start, 1u }, for_each_move, is_end);
+		}
+
+		// Searches everywhere reachable, to fill in the whole distance field.
+		template <typename ForEachMoveFunc>
+		void fill(std::span<const state_id> start_states, const ForEachMoveFunc& for_each_move)
+		{
+			run(start_states, for_each_move, [](state_id) { return false; });
+		}
+
+		template <typename ForEachMoveFunc>
+		void fill(state_id start, const ForEachMoveFunc& for_each_move)
+		{
+			fill(std::span<const state_id>{ &start, 1u }, for_each_move);
+		}
+
+		CostType get_cost(state_id id) const
+		{
+			AdventCheck(id < num_states());
+			return m_costs[id];
+		}
+
+		bool is_reachable(state_id id) const { return get_cost(id) != unreachable; }
+
+		// The lowest cost to reach the cell in any layer.
+		CostType get_cell_cost(utils::coords location) const
+		{
+			const state_id first = get_id(location);
+			return *std::min_element(begin(m_costs) + first, begin(m_costs) + first + m_num_layers);
+		}
+
+		// The state this one was reached from on a cheapest path, or no_state for start states and unreached states.
+		state_id get_previous(state_id id) const
+		{
+			AdventCheck(id < num_states());
+			return m_previous[id];
+		}
+
+		// Costs of every state, indexed by state ID. Unreached states have the cost 'unreachable'.
+		std::span<const CostType> get_distance_field() const noexcept { return m_costs; }
+
+		// The states on a cheapest path from a start state to this one, with the start first.
+		// Empty if the state was not reached.
+		std::vector<state_id> get_path(state_id end) const
+		{
+			std::vector<state_id> result;
+			if (!is_reachable(end)) return result;
+			for (state_id id = end; id != no_state; id = m_previous[id])
+			{
+				result.push_back(id);
+			}
+			std::ranges::reverse(result);
+			return result;
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <vector>
+#include <limits>
+#include <utility>
+#include <algorithm>
+#include <cstdint>
+
+#include "advent/advent_assert.h"
+#include "coords.h"
+#include "grid.h"
+#include "indexed_heap.h"
+
+namespace utils
+{
+	// Lifelong Planning A* (LPA*) from one cell to another on a 4-connected grid, where every step costs 1.
+	// The search tree is kept between queries, so after cells are blocked or unblocked only the part of the tree
+	// that depended on them gets repaired, instead of searching again from scratch. Changes are cheap: the repair
+	// happens lazily the next time the distance is asked for.
+	class incremental_grid_search
+	{
+	public:
+		using cost_type = int64_t;
+		static constexpr cost_type unreachable = std::numeric_limits<cost_type>::max() / 4;
+	private:
+		// Ordered by estimated total cost first, then by cost so far.
+		using key_type = std::pair<cost_type, cost_type>;
+
+		utils::coords m_size;
+		std::size_t m_start_id = 0u;
+		std::size_t m_goal_id = 0u;
+		utils::coords m_goal;
+		std::vector<bool> m_blocked;
+		// g is the cost the search has settled on, and rhs the cost the neighbours currently offer.
+		// A cell needs looking at again while the two differ.
+		std::vector<cost_type> m_g;
+		std::vector<cost_type> m_rhs;
+		indexed_heap<key_type> m_open;
+
+		std::size_t get_id(utils::coords location) const
+		{
+			AdventCheck(is_on_grid(location));
+			return static_cast<std::size_t>(location.y) * static_cast<std::size_t>(m_size.x) + static_cast<std::size_t>(location.x);
+		}
+
+		utils::coords get_location(std::size_t id) const
+		{
+			const std::size_t width = static_cast<std::size_t>(m_size.x);
+			return utils::coords{ static_cast<int>(id % width), static_cast<int>(id / width) };
+		}
+
+		key_type calculate_key(std::size_t id) const
+		{
+			const cost_type best = std::min(m_g[id], m_rhs[id]);
+			return key_type{ best + get_location(id).manhatten_distance(m_goal), best };
+		}
+
+		template <typename NeighbourFunc>
+		void for_each_neighbour(std::size_t id, const NeighbourFunc& fn) const
+		{
+			for (const utils::coords& next : get_location(id).neighbours())
+			{
+				if (is_on_grid(next))
+				{
+					fn(get_id(next));
+				}
+			}
+		}
+
+		void update_cell(std::size_t id)
+		{
+			if (id == m_start_id)
+			{
+				m_rhs[id] = m_blocked[id] ? unreachable : 0;
+			}
+			else
+			{
+				cost_type best = unreachable;
+				if (!m_blocked[id])
+				{
+					for_each_neighbour(id, [this, &best](std::size_t neighbour)
+						{
+							if (!m_blocked[neighbour])
+							{
+								best = std::min(best, m_g[neighbour] + 1);
+							}
+						});
+				}
+				m_rhs[id] = std::min(best, unreachable);
+			}
+
+			if (m_open.contains(id))
+			{
+				m_open.erase(id);
+			}
+			if (m_g[id] != m_rhs[id])
+			{
+				m_open.push(id, calculate_key(id));
+			}
+		}
+
+		void compute_shortest_path()
+		{
+			auto update = [this](std::size_t id) { update_cell(id); };
+			while (!m_open.empty() && (m_open.top_priority() < calculate_key(m_goal_id) || m_rhs[m_goal_id] != m_g[m_goal_id]))
+			{
+				const std::size_t id = m_open.pop();
+				if (m_g[id] > m_rhs[id])
+				{
+					m_g[id] = m_rhs[id];
+					for_each_neighbour(id, update);
+				}
+				else
+				{
+					m_g[id] = unreachable;
+					update_cell(id);
+					for_each_neighbour(id, update);
+				}
+			}
+		}
+
+		void set_blocked(utils::coords location, bool blocked)
+		{
+			const std::size_t id = get_id(location);
+			if (m_blocked[id] == blocked) return;
+			m_blocked[id] = blocked;
+			update_cell(id);
+			for_each_neighbour(id, [this](std::size_t neighbour) { update_cell(neighbour); });
+		}
+	public:
+		incremental_grid_search(utils::coords grid_size, utils::coords start, utils::coords goal)
+			: m_size{ grid_size }, m_goal{ goal }
+		{
+			AdventCheck(grid_size.x > 0 && grid_size.y > 0);
+			const std::size_t num_cells = static_cast<std::size_t>(grid_size.x) * static_cast<std::size_t>(grid_size.y);
+			m_start_id = get_id(start);
+			m_goal_id = get_id(goal);
+			m_blocked.resize(num_cells, false);
+			m_g.resize(num_cells, unreachable);
+			m_rhs.resize(num_cells, unreachable);
+			m_open.reserve(num_cells);
+			update_cell(m_start_id);
+		}
+
+		// Starts with every cell of the grid for which is_blocked(coords, node) returns true already blocked.
+		template <typename NodeType, typename IsBlockedFunc>
+		incremental_grid_search(const utils::grid<NodeType>& grid, utils::coords start, utils::coords goal, const IsBlockedFunc& is_blocked)
+			: incremental_grid_search{ grid.get_max_point(), start, goal }
+		{
+			for (const utils::coords& location : utils::coords_iterators::elem_range{ grid.get_max_point() })
+			{
+				if (is_blocked(location, grid[location]))
+				{
+					m_blocked[get_id(location)] = true;
+				}
+			}
+			update_cell(m_start_id);
+		}
+
+		bool is_on_grid(utils::coords location) const noexcept
+		{
+			return location.x >= 0 && location.y >= 0 && location.x < m_size.x && location.y < m_size.y;
+		}
+
+		bool is_blocked(utils::coords location) const { return m_blocked[get_id(location)]; }
+		void block(utils::coords location) { set_blocked(location, true); }
+		void unblock(utils::coords location) { set_blocked(location, false); }
+
+		// The number of steps from the start to the goal, or 'unreachable'.
+		cost_type get_distance()
+		{
+			compute_shortest_path();
+			return m_g[m_goal_id];
+		}
+
+		bool is_goal_reachable() { return get_distance() != unreachable; }
+	};
+}
\ No newline at end of file
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <cstddef>
+
+#include "advent/advent_assert.h"
+
+namespace utils
+{
+	// A d-ary min-heap of keys, where each key is a small index (e.g. a node ID) with a priority.
+	// Because it knows where every key is, a key's priority can be lowered in place with decrease_key instead of
+	// pushing a duplicate. Wider heaps (Arity 4 or 8) are shallower and touch fewer cache lines per pop than a
+	// binary heap. The key with the lowest priority according to Compare is on top.
+	template <typename PriorityType, std::size_t Arity = 4, typename Compare = std::less<PriorityType>>
+	class indexed_heap
+	{
+		static_assert(Arity >= 2, "A heap needs at least two children per node");
+		struct entry
+		{
+			PriorityType priority;
+			std::size_t key;
+		};
+
+		static constexpr std::size_t not_in_heap = std::numeric_limits<std::size_t>::max();
+
+		std::vector<entry> m_heap;
+		std::vector<std::size_t> m_positions;
+		[[no_unique_address]] Compare m_compare;
+
+		void place(std::size_t pos, entry e)
+		{
+			m_positions[e.key] = pos;
+			m_heap[pos] = std::move(e);
+		}
+
+		void sift_up(std::size_t pos)
+		{
+			entry moving = std::move(m_heap[pos]);
+			while (pos > 0u)
+			{
+				const std::size_t parent = (pos - 1u) / Arity;
+				if (!m_compare(moving.priority, m_heap[parent].priority)) break;
+				place(pos, std::move(m_heap[parent]));
+				pos = parent;
+			}
+			place(pos, std::move(moving));
+		}
+
+		void sift_down(std::size_t pos)
+		{
+			entry moving = std::move(m_heap[pos]);
+			const std::size_t size = m_heap.size();
+			while (true)
+			{
+				const std::size_t first_child = pos * Arity + 1u;
+				if (first_child >= size) break;
+				const std::size_t last_child = std::min(first_child + Arity, size);
+				std::size_t best_child = first_child;
+				for (std::size_t child = first_child + 1u; child < last_child; ++child)
+				{
+					if (m_compare(m_heap[child].priority, m_heap[best_child].priority))
+					{
+						best_child = child;
+					}
+				}
+				if (!m_compare(m_heap[best_child].priority, moving.priority)) break;
+				place(pos, std::move(m_heap[best_child]));
+				pos = best_child;
+			}
+			place(pos, std::move(moving));
+		}
+	public:
+		indexed_heap() = default;
+		explicit indexed_heap(Compare compare) : m_compare{ std::move(compare) } {}
+
+		// num_keys is one more than the largest key expected. Keys beyond that still work but cause reallocation.
+		void reserve(std::size_t num_keys)
+		{
+			m_heap.reserve(num_keys);
+			if (m_positions.size() < num_keys)
+			{
+				m_positions.resize(num_keys, not_in_heap);
+			}
+		}
+
+		bool empty() const noexcept { return m_heap.empty(); }
+		std::size_t size() const noexcept { return m_heap.size(); }
+
+		bool contains(std::size_t key) const noexcept
+		{
+			return key < m_positions.size() && m_positions[key] != not_in_heap;
+		}
+
+		const PriorityType& priority(std::size_t key) const
+		{
+			AdventCheck(contains(key));
+			return m_heap[m_positions[key]].priority;
+		}
+
+		std::size_t top() const
+		{
+			AdventCheck(!empty());
+			return m_heap.front().key;
+		}
+
+		const PriorityType& top_priority() const
+		{
+			AdventCheck(!empty());
+			return m_heap.front().priority;
+		}
+
+		void push(std::size_t key, PriorityType priority)
+		{
+			AdventCheck(!contains(key));
+			if (key >= m_positions.size())
+			{
+				m_positions.resize(std::max(key + 1u, m_positions.size() * 2u), not_in_heap);
+			}
+			m_heap.push_back(entry{ std::move(priority), key });
+			m_positions[key] = m_heap.size() - 1u;
+			sift_up(m_heap.size() - 1u);
+		}
+
+		// The new priority must not be worse than the current one.
+		void decrease_key(std::size_t key, PriorityType priority)
+		{
+			AdventCheck(contains(key));
+			const std::size_t pos = m_positions[key];
+			AdventCheck(!m_compare(m_heap[pos].priority, priority));
+			m_heap[pos].priority = std::move(priority);
+			sift_up(pos);
+		}
+
+		// Pushes the key if it isn't in the heap, or lowers its priority if the new one is better.
+		// Returns false if the key was already there with an equal or better priority.
+		bool push_or_decrease(std::size_t key, PriorityType priority)
+		{
+			if (!contains(key))
+			{
+				push(key, std::move(priority));
+				return true;
+			}
+			if (!m_compare(priority, m_heap[m_positions[key]].priority)) return false;
+			decrease_key(key, std::move(priority));
+			return true;
+		}
+
+		// Removes the key from anywhere in the heap.
+		void erase(std::size_t key)
+		{
+			AdventCheck(contains(key));
+			const std::size_t pos = m_positions[key];
+			m_positions[key] = not_in_heap;
+			entry last = std::move(m_heap.back());
+			m_heap.pop_back();
+			if (pos == m_heap.size()) return;
+			const bool moves_up = m_compare(last.priority, m_heap[pos].priority);
+			place(pos, std::move(last));
+			if (moves_up)
+			{
+				sift_up(pos);
+			}
+			else
+			{
+				sift_down(pos);
+			}
+		}
+
+		// Removes the key on top and returns it.
+		std::size_t pop()
+		{
+			AdventCheck(!empty());
+			const std::size_t result = m_heap.front().key;
+			m_positions[result] = not_in_heap;
+			entry last = std::move(m_heap.back());
+			m_heap.pop_back();
+			if (!m_heap.empty())
+			{
+				m_heap.front() = std::move(last);
+				sift_down(0u);
+			}
+			return result;
+		}
+
+		void clear() noexcept
+		{
+			for (const entry& e : m_heap)
+			{
+				m_positions[e.key] = not_in_heap;
+			}
+			m_heap.clear();
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,286 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+
+#include "advent/advent_assert.h"
+#include "coords.h"
+#include "grid_search.h"
+
+namespace utils
+{
+	// Jump Point Search (Harabor and Grastien) on a grid where every open cell costs the same to step into.
+	// Instead of adding every neighbour to the open set, it runs in straight lines (and diagonals) from each node
+	// until it hits something interesting: the end, or a cell next to an obstacle where a cheapest path might have to
+	// turn. Only those jump points go in the open set. Paths that are just reorderings of the same moves get pruned,
+	// so on mostly open grids it expands a small fraction of the cells A* would.
+	// Where each line ends is worked out up front for every cell and direction, in a few sweeps across the grid, so
+	// during the search every jump is a single lookup.
+	// With allow_diagonal, steps to all 8 neighbours are allowed and diagonals cost sqrt(2). A diagonal can't cut a
+	// corner: both of the cells beside it must be open.
+	// It's built on grid_search, which remembers the node each jump point was reached from. That's all the pruning
+	// needs to know which way the search was going.
+	template <bool allow_diagonal, typename CostType = std::conditional_t<allow_diagonal, float, int64_t>>
+	class jump_point_search
+	{
+	public:
+		using cost_type = CostType;
+	private:
+		using search_type = grid_search<CostType>;
+		using state_id = typename search_type::state_id;
+		search_type m_search;
+
+		static int sign(int value) noexcept { return (value > 0) - (value < 0); }
+
+		static CostType get_step_cost(utils::coords from, utils::coords to)
+		{
+			const int dx = std::abs(to.x - from.x);
+			const int dy = std::abs(to.y - from.y);
+			if constexpr (allow_diagonal)
+			{
+				const int num_diagonal = std::min(dx, dy);
+				return static_cast<CostType>(std::sqrt(2.0) * num_diagonal) + static_cast<CostType>(std::max(dx, dy) - num_diagonal);
+			}
+			else
+			{
+				return static_cast<CostType>(dx + dy);
+			}
+		}
+
+		static constexpr std::size_t num_directions = allow_diagonal ? 8u : 4u;
+		static constexpr std::size_t right = 0u;
+		static constexpr std::size_t left = 1u;
+
+		static utils::coords get_direction(std::size_t index) noexcept
+		{
+			constexpr std::array<utils::coords, 8> directions{
+				utils::coords{ 1,0 }, utils::coords{ -1,0 }, utils::coords{ 0,1 }, utils::coords{ 0,-1 },
+				utils::coords{ 1,1 }, utils::coords{ -1,1 }, utils::coords{ 1,-1 }, utils::coords{ -1,-1 } };
+			return directions[index];
+		}
+
+		static std::size_t get_direction_index(utils::coords direction) noexcept
+		{
+			if (direction.y == 0) return direction.x > 0 ? 0u : 1u;
+			if (direction.x == 0) return direction.y > 0 ? 2u : 3u;
+			return 4u + (direction.x < 0 ? 1u : 0u) + (direction.y < 0 ? 2u : 0u);
+		}
+
+		// The flags and jumps have a border of blocked cells all the way round, so nothing needs bounds checks.
+		utils::coords m_size;
+		std::ptrdiff_t m_stride = 0;
+		std::vector<uint8_t> m_open;
+		std::vector<uint8_t> m_end;
+		// For each direction and cell, how many steps it is to the next jump point that way, or 0 if there isn't one.
+		std::array<std::vector<uint32_t>, num_directions> m_jumps;
+
+		std::size_t get_cell(utils::coords location) const noexcept
+		{
+			return static_cast<std::size_t>((location.y + 1) * m_stride + location.x + 1);
+		}
+
+		std::ptrdiff_t get_offset(utils::coords direction) const noexcept
+		{
+			return direction.y * m_stride + direction.x;
+		}
+
+		bool is_jump_point(std::size_t cell, utils::coords direction) const noexcept
+		{
+			if (m_end[cell]) return true;
+			if (direction.x != 0 && direction.y != 0)
+			{
+				// Diagonals stop wherever one of the straight lines they pass would.
+				return m_jumps[get_direction_index(utils::coords{ direction.x, 0 })][cell] != 0u
+					|| m_jumps[get_direction_index(utils::coords{ 0, direction.y })][cell] != 0u;
+			}
+
+			// A forced neighbour: a cell to one side that is open, but wasn't open beside the cell before. A cheapest
+			// path could turn into it here without there being an equally cheap one that turned earlier.
+			const std::ptrdiff_t side = get_offset(utils::coords{ direction.y, direction.x });
+			const std::size_t previous = cell - get_offset(direction);
+			if ((m_open[cell + side] && !m_open[previous + side]) || (m_open[cell - side] && !m_open[previous - side])) return true;
+
+			// Without diagonals, going up or down plays the part of a diagonal: it stops where going along the row would.
+			return !allow_diagonal && direction.y != 0 && (m_jumps[right][cell] != 0u || m_jumps[left][cell] != 0u);
+		}
+
+		// Fills in the jumps one way across the whole grid, starting from the far side so each cell can build on the
+		// one after it. The straight directions must be done first, horizontals before verticals.
+		void build_jumps(std::size_t direction_index)
+		{
+			const utils::coords direction = get_direction(direction_index);
+			const std::ptrdiff_t step = get_offset(direction);
+			const bool is_diagonal = direction.x != 0 && direction.y != 0;
+			const std::ptrdiff_t step_x = get_offset(utils::coords{ direction.x, 0 });
+			const std::ptrdiff_t step_y = get_offset(utils::coords{ 0, direction.y });
+			std::vector<uint32_t>& jumps = m_jumps[direction_index];
+			const int x_step = direction.x > 0 ? -1 : 1;
+			const int y_step = direction.y > 0 ? -1 : 1;
+			for (int y = direction.y > 0 ? m_size.y - 1 : 0; y >= 0 && y < m_size.y; y += y_step)
+			{
+				for (int x = direction.x > 0 ? m_size.x - 1 : 0; x >= 0 && x < m_size.x; x += x_step)
+				{
+					const std::size_t cell = get_cell(utils::coords{ x, y });
+					const std::size_t next = cell + step;
+					uint32_t result = 0u;
+					// Diagonals can't cut corners.
+					if (m_open[next] && (!is_diagonal || (m_open[cell + step_x] && m_open[cell + step_y])))
+					{
+						if (is_jump_point(next, direction))
+						{
+							result = 1u;
+						}
+						else if (jumps[next] != 0u)
+						{
+							result = jumps[next] + 1u;
+						}
+					}
+					jumps[cell] = result;
+				}
+			}
+		}
+
+		template <typename IsBlockedFunc, typename IsEndFunc>
+		void build_jumps(const IsBlockedFunc& is_blocked, const IsEndFunc& is_end)
+		{
+			for (int y = 0; y < m_size.y; ++y)
+			{
+				for (int x = 0; x < m_size.x; ++x)
+				{
+					const utils::coords location{ x, y };
+					const std::size_t cell = get_cell(location);
+					const bool open = !is_blocked(location);
+					m_open[cell] = open ? 1u : 0u;
+					m_end[cell] = (open && is_end(location)) ? 1u : 0u;
+				}
+			}
+			for (std::size_t direction_index = 0u; direction_index < num_directions; ++direction_index)
+			{
+				build_jumps(direction_index);
+			}
+		}
+	public:
+		explicit jump_point_search(utils::coords grid_size) : m_search{ grid_size }, m_size{ grid_size }, m_stride{ grid_size.x + 2 }
+		{
+			const std::size_t num_cells = static_cast<std::size_t>(m_stride) * static_cast<std::size_t>(grid_size.y + 2);
+			m_open.resize(num_cells, 0u);
+			m_end.resize(num_cells, 0u);
+			// The border never gets written, so it stays at 0.
+			for (std::vector<uint32_t>& jumps : m_jumps)
+			{
+				jumps.resize(num_cells, 0u);
+			}
+		}
+
+		utils::coords get_size() const noexcept { return m_search.get_size(); }
+		bool is_on_grid(utils::coords location) const noexcept
+		{
+			return location.x >= 0 && location.y >= 0 && location.x < m_size.x && location.y < m_size.y;
+		}
+
+		// IsBlockedFunc: bool f(utils::coords). Cells off the grid are always blocked.
+		// IsEndFunc: bool f(utils::coords). The search stops at the first end cell it reaches.
+		// HeuristicFunc: CostType f(utils::coords). Must never overestimate the remaining cost.
+		// Returns every cell on a cheapest path, from the start to the end, or an empty path if there isn't one.
+		template <typename IsBlockedFunc, typename IsEndFunc, typename HeuristicFunc>
+		std::vector<utils::coords> find_path(utils::coords start, const IsBlockedFunc& is_blocked, const IsEndFunc& is_end, const HeuristicFunc& heuristic)
+		{
+			std::vector<utils::coords> result;
+			AdventCheck(is_on_grid(start));
+			build_jumps(is_blocked, is_end);
+			if (!m_open[get_cell(start)]) return result;
+
+			auto for_each_move = [this](state_id from_id, auto&& add_move)
+				{
+					const utils::coords from = m_search.get_location(from_id);
+					const std::size_t from_cell = get_cell(from);
+					auto try_direction = [this, &add_move, from, from_cell](utils::coords direction)
+						{
+							const uint32_t steps = m_jumps[get_direction_index(direction)][from_cell];
+							if (steps == 0u) return;
+							const int num_steps = static_cast<int>(steps);
+							const utils::coords jump_point = from + utils::coords{ direction.x * num_steps, direction.y * num_steps };
+							add_move(m_search.get_id(jump_point), get_step_cost(from, jump_point));
+						};
+
+					const state_id previous_id = m_search.get_previous(from_id);
+					if (previous_id == search_type::no_state)
+					{
+						for (std::size_t direction_index = 0u; direction_index < num_directions; ++direction_index)
+						{
+							try_direction(get_direction(direction_index));
+						}
+						return;
+					}
+
+					const utils::coords previous = m_search.get_location(previous_id);
+					const utils::coords direction{ sign(from.x - previous.x), sign(from.y - previous.y) };
+					try_direction(direction);
+					if (direction.x != 0 && direction.y != 0)
+					{
+						try_direction(utils::coords{ direction.x, 0 });
+						try_direction(utils::coords{ 0, direction.y });
+						return;
+					}
+
+					// Either side of a straight line, and the diagonals forward to either side.
+					const utils::coords side{ direction.y, direction.x };
+					for (const utils::coords& turn : { side, utils::coords{} - side })
+					{
+						try_direction(turn);
+						if constexpr (allow_diagonal)
+						{
+							try_direction(direction + turn);
+						}
+					}
+				};
+
+			const state_id start_id = m_search.get_id(start);
+			const state_id end_id = m_search.run(std::span<const state_id>{ &start_id, 1u }, for_each_move,
+				[this](state_id id) { return m_end[get_cell(m_search.get_location(id))]; },
+				[this, &heuristic](state_id id) { return static_cast<CostType>(heuristic(m_search.get_location(id))); });
+			if (end_id == search_type::no_state) return result;
+
+			// Fill in the cells between the jump points, which are always in a straight or diagonal line.
+			const std::vector<state_id> jump_points = m_search.get_path(end_id);
+			result.push_back(start);
+			for (std::size_t i = 1u; i < jump_points.size(); ++i)
+			{
+				const utils::coords target = m_search.get_location(jump_points[i]);
+				utils::coords location = result.back();
+				const utils::coords direction{ sign(target.x - location.x), sign(target.y - location.y) };
+				while (location != target)
+				{
+					location += direction;
+					result.push_back(location);
+				}
+			}
+			return result;
+		}
+
+		// As above, heading for one end cell with the straight-line distance as the heuristic.
+		template <typename IsBlockedFunc>
+		std::vector<utils::coords> find_path(utils::coords start, utils::coords end, const IsBlockedFunc& is_blocked)
+		{
+			AdventCheck(is_on_grid(end));
+			return find_path(start, is_blocked,
+				[end](utils::coords location) { return location == end; },
+				[end](utils::coords location) { return get_step_cost(location, end); });
+		}
+
+		// The cost of a path returned by find_path.
+		static CostType get_path_cost(const std::vector<utils::coords>& path)
+		{
+			CostType result{};
+			for (std::size_t i = 1u; i < path.size(); ++i)
+			{
+				result += get_step_cost(path[i - 1], path[i]);
+			}
+			return result;
+		}
+	};
+}
\ No newline at end of file
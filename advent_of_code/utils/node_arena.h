@@ -0,0 +1,99 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <new>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+#include "advent/advent_assert.h"
+
+namespace utils
+{
+	// Monotonic storage for the nodes of a search. Nodes are only ever added, and are known by their index, which
+	// makes a small and cheap link from one node to another (like a predecessor).
+	// Storage comes in fixed-size blocks that never move, so references to nodes stay valid as more are added.
+	// reset() destroys the nodes but keeps the blocks, so running another search on the same arena doesn't go back
+	// to the allocator until it needs more room than any search before it.
+	template <typename T, std::size_t block_size = 1024u>
+	class node_arena
+	{
+		static_assert(block_size > 0u && (block_size & (block_size - 1u)) == 0u, "block_size must be a power of two");
+		struct block
+		{
+			alignas(T) std::byte storage[sizeof(T) * block_size];
+		};
+		std::vector<std::unique_ptr<block>> m_blocks;
+		std::size_t m_size = 0u;
+
+		T* get_pointer(std::size_t index) const noexcept
+		{
+			return std::launder(reinterpret_cast<T*>(m_blocks[index / block_size]->storage + (index % block_size) * sizeof(T)));
+		}
+	public:
+		using index_type = std::size_t;
+
+		node_arena() = default;
+		node_arena(const node_arena&) = delete;
+		node_arena& operator=(const node_arena&) = delete;
+		node_arena(node_arena&& other) noexcept : m_blocks{ std::move(other.m_blocks) }, m_size{ std::exchange(other.m_size, 0u) } {}
+		node_arena& operator=(node_arena&& other) noexcept
+		{
+			if (this != &other)
+			{
+				reset();
+				m_blocks = std::move(other.m_blocks);
+				m_size = std::exchange(other.m_size, 0u);
+			}
+			return *this;
+		}
+		~node_arena() { reset(); }
+
+		std::size_t size() const noexcept { return m_size; }
+		bool empty() const noexcept { return m_size == 0u; }
+		std::size_t capacity() const noexcept { return m_blocks.size() * block_size; }
+
+		void reserve(std::size_t num_nodes)
+		{
+			while (capacity() < num_nodes)
+			{
+				m_blocks.push_back(std::make_unique_for_overwrite<block>());
+			}
+		}
+
+		// Returns the index of the new node.
+		template <typename... Args>
+		index_type emplace_back(Args&&... args)
+		{
+			reserve(m_size + 1u);
+			std::construct_at(get_pointer(m_size), std::forward<Args>(args)...);
+			return m_size++;
+		}
+
+		T& operator[](index_type index)
+		{
+			AdventCheck(index < m_size);
+			return *get_pointer(index);
+		}
+
+		const T& operator[](index_type index) const
+		{
+			AdventCheck(index < m_size);
+			return *get_pointer(index);
+		}
+
+		// Destroys every node, keeping the memory for the next search.
+		void reset() noexcept
+		{
+			if constexpr (!std::is_trivially_destructible_v<T>)
+			{
+				for (std::size_t i = 0u; i < m_size; ++i)
+				{
+					std::destroy_at(get_pointer(i));
+				}
+			}
+			m_size = 0u;
+		}
+	};
+}
\ No newline at end of file
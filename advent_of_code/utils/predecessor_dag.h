@@ -0,0 +1,222 @@
+#pragma once
+
+#include <vector>
+#include <span>
+#include <limits>
+#include <cstdint>
+
+#include "advent/advent_assert.h"
+#include "advent/advent_cancellation.h"
+#include "indexed_heap.h"
+
+namespace utils
+{
+	// Every cheapest way of reaching each state, kept as a DAG of predecessors over dense state IDs.
+	// A state can have any number of equally good predecessors. They're stored as linked lists in one shared edge
+	// pool, so no path is ever copied out: questions like "which states are on any cheapest path" or "how many
+	// cheapest paths are there" are answered by walking the DAG.
+	class predecessor_dag
+	{
+	public:
+		using state_id = std::size_t;
+		static constexpr state_id no_state = std::numeric_limits<state_id>::max();
+	private:
+		static constexpr std::size_t no_edge = std::numeric_limits<std::size_t>::max();
+		struct edge
+		{
+			state_id from;
+			std::size_t next_edge;
+		};
+		std::vector<std::size_t> m_first_edge;
+		std::vector<edge> m_edges;
+		std::vector<state_id> m_finalised_order;
+	public:
+		explicit predecessor_dag(std::size_t num_states = 0u) { reset(num_states); }
+
+		void reset(std::size_t num_states)
+		{
+			m_first_edge.assign(num_states, no_edge);
+			m_edges.clear();
+			m_finalised_order.clear();
+		}
+
+		std::size_t num_states() const noexcept { return m_first_edge.size(); }
+
+		// A cheaper way to reach 'to' was found: forget the others.
+		// The old edges stay in the pool until the next reset.
+		void set_predecessor(state_id to, state_id from)
+		{
+			AdventCheck(to < num_states());
+			m_first_edge[to] = no_edge;
+			add_predecessor(to, from);
+		}
+
+		// Another way to reach 'to', just as cheap as the ones already known.
+		void add_predecessor(state_id to, state_id from)
+		{
+			AdventCheck(to < num_states());
+			AdventCheck(from < num_states());
+			m_edges.push_back(edge{ from, m_first_edge[to] });
+			m_first_edge[to] = m_edges.size() - 1u;
+		}
+
+		// Records that the state's predecessors won't change again. Every state must be finalised after all of its
+		// predecessors, which is the order Dijkstra's algorithm settles them in when every cost is positive.
+		void finalise(state_id id)
+		{
+			AdventCheck(id < num_states());
+			m_finalised_order.push_back(id);
+		}
+
+		bool has_predecessors(state_id id) const
+		{
+			AdventCheck(id < num_states());
+			return m_first_edge[id] != no_edge;
+		}
+
+		// Calls fn(state_id) for every predecessor of the state.
+		template <typename PredecessorFunc>
+		void for_each_predecessor(state_id id, const PredecessorFunc& fn) const
+		{
+			AdventCheck(id < num_states());
+			for (std::size_t e = m_first_edge[id]; e != no_edge; e = m_edges[e].next_edge)
+			{
+				fn(m_edges[e].from);
+			}
+		}
+
+		// Flags every state on at least one path to one of the end states, including the ends and the starts.
+		std::vector<bool> get_states_on_paths_to(std::span<const state_id> end_states) const
+		{
+			std::vector<bool> result(num_states(), false);
+			std::vector<state_id> to_visit;
+			auto visit = [&result, &to_visit](state_id id)
+				{
+					if (result[id]) return;
+					result[id] = true;
+					to_visit.push_back(id);
+				};
+
+			for (state_id end : end_states)
+			{
+				AdventCheck(end < num_states());
+				visit(end);
+			}
+			while (!to_visit.empty())
+			{
+				const state_id id = to_visit.back();
+				to_visit.pop_back();
+				for_each_predecessor(id, visit);
+			}
+			return result;
+		}
+
+		// The number of different paths from a start (a finalised state without predecessors) to any end state.
+		// Saturates at the largest uint64_t instead of overflowing.
+		uint64_t count_paths_to(std::span<const state_id> end_states) const
+		{
+			constexpr uint64_t max_count = std::numeric_limits<uint64_t>::max();
+			auto saturating_add = [](uint64_t a, uint64_t b) { return a > max_count - b ? max_count : a + b; };
+
+			std::vector<uint64_t> num_paths(num_states(), 0u);
+			for (state_id id : m_finalised_order)
+			{
+				if (!has_predecessors(id))
+				{
+					num_paths[id] = 1u;
+					continue;
+				}
+				uint64_t total = 0u;
+				for_each_predecessor(id, [&total, &num_paths, &saturating_add](state_id from)
+					{
+						total = saturating_add(total, num_paths[from]);
+					});
+				num_paths[id] = total;
+			}
+
+			uint64_t result = 0u;
+			for (state_id end : end_states)
+			{
+				AdventCheck(end < num_states());
+				result = saturating_add(result, num_paths[end]);
+			}
+			return result;
+		}
+	};
+
+	template <typename CostType>
+	struct optimal_paths
+	{
+		static constexpr CostType unreachable = std::numeric_limits<CostType>::max();
+		CostType cost = unreachable;
+		std::vector<predecessor_dag::state_id> end_states;
+		predecessor_dag dag;
+
+		bool found() const noexcept { return !end_states.empty(); }
+		std::vector<bool> get_states_on_paths() const { return dag.get_states_on_paths_to(end_states); }
+		uint64_t count_paths() const { return dag.count_paths_to(end_states); }
+	};
+
+	// Dijkstra's algorithm that keeps every cheapest path instead of just one, over states with IDs 0 to num_states-1.
+	// ForEachMoveFunc: void f(state_id from, auto&& add_move). Calls add_move(state_id to, CostType cost) for
+	//		every move out of 'from'. Costs must be positive.
+	// IsEndFunc: bool f(state_id). The search keeps going until it has found every end state as cheap as the
+	//		first one. It doesn't search onwards from end states.
+	template <typename CostType, typename ForEachMoveFunc, typename IsEndFunc>
+	optimal_paths<CostType> find_all_optimal_paths(std::size_t num_states, std::span<const predecessor_dag::state_id> start_states,
+		const ForEachMoveFunc& for_each_move, const IsEndFunc& is_end)
+	{
+		using state_id = predecessor_dag::state_id;
+		optimal_paths<CostType> result;
+		result.dag.reset(num_states);
+		std::vector<CostType> costs(num_states, optimal_paths<CostType>::unreachable);
+		indexed_heap<CostType> open;
+		open.reserve(num_states);
+
+		for (state_id start : start_states)
+		{
+			AdventCheck(start < num_states);
+			costs[start] = CostType{};
+			open.push_or_decrease(start, CostType{});
+		}
+
+		while (!open.empty() && !(result.cost < open.top_priority()))
+		{
+			advent::throw_if_cancelled();
+			const state_id current = open.pop();
+			result.dag.finalise(current);
+			if (is_end(current))
+			{
+				result.cost = costs[current];
+				result.end_states.push_back(current);
+				continue;
+			}
+
+			const CostType current_cost = costs[current];
+			for_each_move(current, [&result, &costs, &open, current, current_cost, num_states](state_id next, CostType step_cost)
+				{
+					AdventCheck(next < num_states);
+					AdventCheck(CostType{} < step_cost);
+					const CostType cost = current_cost + step_cost;
+					if (cost < costs[next])
+					{
+						costs[next] = cost;
+						result.dag.set_predecessor(next, current);
+						open.push_or_decrease(next, cost);
+					}
+					else if (cost == costs[next])
+					{
+						result.dag.add_predecessor(next, current);
+					}
+				});
+		}
+		return result;
+	}
+
+	template <typename CostType, typename ForEachMoveFunc, typename IsEndFunc>
+	optimal_paths<CostType> find_all_optimal_paths(std::size_t num_states, predecessor_dag::state_id start_state,
+		const ForEachMoveFunc& for_each_move, const IsEndFunc& is_end)
+	{
+		return find_all_optimal_paths<CostType>(num_states, std::span<const predecessor_dag::state_id>{ &start_state, 1u }, for_each_move, is_end);
+	}
+}
\ No newline at end of file
@@ -11,7 +11,7 @@ namespace utils
 	class ring_buffer
 	{
 		utils::small_vector<T,SIZE> m_data;
-		std::size_t m_front_idx;
+		std::size_t m_front_idx = 0u;
 		constexpr std::size_t get_idx(std::size_t i) const noexcept
 		{
 			return (i + m_front_idx) % SIZE;
@@ -7,6 +7,7 @@
 #include <compare>
 #include <algorithm>
 #include <cstring>
+#include <format>
 
 #include "advent/advent_assert.h"
 
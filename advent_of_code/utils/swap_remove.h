@@ -28,7 +28,7 @@ namespace utils
 	bool swap_remove_single(VecType& vector, typename VecType::const_reference value)
 	{
 		static_assert(!std::is_const_v<VecType>, "Input must be non-const.");
-		const VecType::iterator loc = std::find(begin(vector), end(vector), value);
+		const typename VecType::iterator loc = std::find(begin(vector), end(vector), value);
 		if (loc != end(vector))
 		{
 			swap_remove(vector, loc);
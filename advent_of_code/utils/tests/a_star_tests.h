@@ -0,0 +1,13 @@
+#pragma once
+
+#include "utils/tests/utils_tests.h"
+
+DECLARE_UTILS_TEST("indexed_heap - pops in priority order after decrease_key", indexed_heap_pop_order, "[3,1,4,0,2]");
+DECLARE_UTILS_TEST("indexed_heap - erase from the middle keeps the heap ordered", indexed_heap_erase, "[4,3,1,0]");
+DECLARE_UTILS_TEST("a_star - cheaper route found after a node was first reached", a_star_weighted_decrease_key, "3:[0,2,1,3]");
+DECLARE_UTILS_TEST("a_star - shortest path around a wall on a grid", a_star_grid_with_wall, "27");
+DECLARE_UTILS_TEST("a_star_bidirectional - directed graph uses reverse edges from the end", a_star_bidirectional_directed, "3:[0,2,1,3]");
+DECLARE_UTILS_TEST("a_star_bidirectional - shortest path around a wall on a grid", a_star_bidirectional_grid_with_wall, "27");
+DECLARE_UTILS_TEST("a_star_multi_target - every target in one search, in the order asked", a_star_multi_target_costs, "[3,0,1,unreachable,3]");
+DECLARE_UTILS_TEST("a_star_workspace - one workspace reused for searches to different targets", a_star_workspace_reuse, "27:9:27");
+DECLARE_UTILS_TEST("node_arena - nodes stay put as it grows, and reset keeps the memory", node_arena_stable_and_reset, "100:112:0:112");
\ No newline at end of file
@@ -0,0 +1,8 @@
+#pragma once
+
+#include "utils/tests/utils_tests.h"
+
+DECLARE_UTILS_TEST("bucket_queue - pops in priority order as the ring of buckets wraps around", bucket_queue_ring_wrap, "[0:0,2:2,3:1,4:5,5:3,6:4]");
+DECLARE_UTILS_TEST("bucket_dijkstra - stale entries are skipped after a cheaper route is found", bucket_dijkstra_stale_entries, "3:[0,2,1,3]:1");
+DECLARE_UTILS_TEST("bucket_dijkstra - unreachable target gives an empty path", bucket_dijkstra_unreachable, "0:0");
+DECLARE_UTILS_TEST("bucket_dijkstra - same costs as a_star on a weighted grid", bucket_dijkstra_matches_a_star, "same");
\ No newline at end of file
@@ -0,0 +1,8 @@
+#pragma once
+
+#include "utils/tests/utils_tests.h"
+
+DECLARE_UTILS_TEST("delta_stepping - same distances as Dijkstra for any bucket width and thread count", delta_stepping_matches_dijkstra, "same:same:same:same");
+DECLARE_UTILS_TEST("delta_stepping - distance field over a grid", delta_stepping_grid_distances, "16:unreachable");
+DECLARE_UTILS_TEST("delta_stepping - long chain with one expensive move wraps the ring of buckets", delta_stepping_long_chain, "9999:5099");
+DECLARE_UTILS_TEST("delta_stepping - distances too many buckets away to number are rejected", delta_stepping_bucket_overflow, "rejected");
\ No newline at end of file
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "utils/tests/utils_tests.h"
+
+DECLARE_UTILS_TEST("grid_search - distance field with a layer per direction", grid_search_distance_field_layers, "10:14:0");
+DECLARE_UTILS_TEST("grid - get_path around walls", grid_get_path_around_walls, "17");
+DECLARE_UTILS_TEST("grid - get_path with the default cost ignores what's in the cells", grid_get_path_default_cost, "5:5");
+DECLARE_UTILS_TEST("jump_point_search - cheapest paths with and without diagonals", jump_point_search_paths, "16:9:6");
+DECLARE_UTILS_TEST("incremental_grid_search - distance after blocking and unblocking cells", incremental_grid_search_block_unblock, "4:12:8:unreachable");
+DECLARE_UTILS_TEST("incremental_grid_search - same distance as a fresh search after random changes", incremental_grid_search_matches_bfs, "same");
+DECLARE_UTILS_TEST("grid_connectivity - first blocking cell with and without diagonals", grid_connectivity_first_blocking_cell, "1:never");
+DECLARE_UTILS_TEST("grid_connectivity - start and finish already apart before any insertion", grid_connectivity_disconnected_from_the_start, "initially:initially");
\ No newline at end of file
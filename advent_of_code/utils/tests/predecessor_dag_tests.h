@@ -0,0 +1,6 @@
+#pragma once
+
+#include "utils/tests/utils_tests.h"
+
+DECLARE_UTILS_TEST("predecessor_dag - every shortest path across an open grid", predecessor_dag_open_grid, "4:6:9");
+DECLARE_UTILS_TEST("predecessor_dag - path count saturates instead of overflowing", predecessor_dag_count_saturates, "18446744073709551615");
\ No newline at end of file
@@ -0,0 +1,218 @@
+#include "utils/tests/a_star_tests.h"
+
+#if UTILS_TESTING
+
+#include "utils/a_star.h"
+#include "utils/indexed_heap.h"
+#include "utils/node_arena.h"
+#include "utils/coords.h"
+
+namespace
+{
+	// A 10x10 grid with a wall along x == 5, open only at y == 9.
+	struct walled_grid
+	{
+		static constexpr int size = 10;
+
+		static bool is_open(utils::coords c)
+		{
+			return c.x >= 0 && c.y >= 0 && c.x < size && c.y < size && (c.x != 5 || c.y == size - 1);
+		}
+
+		static std::vector<utils::coords> get_next_nodes(utils::coords c)
+		{
+			std::vector<utils::coords> result;
+			for (utils::coords offset : { utils::coords::up(), utils::coords::down(), utils::coords::left(), utils::coords::right() })
+			{
+				if (is_open(c + offset)) result.push_back(c + offset);
+			}
+			return result;
+		}
+
+		static std::size_t get_hash(utils::coords c)
+		{
+			return static_cast<std::size_t>(c.y) * size + static_cast<std::size_t>(c.x);
+		}
+	};
+}
+
+ResultType indexed_heap_pop_order()
+{
+	utils::indexed_heap<int> heap;
+	heap.push(0, 40);
+	heap.push(1, 20);
+	heap.push(2, 50);
+	heap.push(3, 30);
+	heap.push(4, 35);
+	heap.decrease_key(3, 10);
+	std::vector<std::size_t> order;
+	while (!heap.empty())
+	{
+		order.push_back(heap.pop());
+	}
+	return utils::testing::print_container(order);
+}
+
+ResultType indexed_heap_erase()
+{
+	utils::indexed_heap<int, 2> heap;
+	for (int key : { 0, 1, 2, 3, 4, 5 })
+	{
+		heap.push(static_cast<std::size_t>(key), 60 - 10 * key);
+	}
+	heap.erase(5u);
+	heap.erase(2u);
+	std::vector<std::size_t> order;
+	while (!heap.empty())
+	{
+		order.push_back(heap.pop());
+	}
+	return utils::testing::print_container(order);
+}
+
+ResultType a_star_weighted_decrease_key()
+{
+	// 0 reaches 1 directly for 10, or through 2 for 2.
+	auto get_next_nodes = [](int node)
+		{
+			switch (node)
+			{
+			case 0: return std::vector<int>{ 1, 2 };
+			case 1: return std::vector<int>{ 3 };
+			case 2: return std::vector<int>{ 1 };
+			default: return std::vector<int>{};
+			}
+		};
+	auto get_cost = [](int from, int to) { return (from == 0 && to == 1) ? 10 : 1; };
+	const auto [path, cost] = utils::a_star(0, [](int node) { return node == 3; }, get_next_nodes, get_cost, [](int) { return 0; }, std::equal_to<int>{});
+	return std::to_string(cost) + ':' + utils::testing::print_container(path);
+}
+
+ResultType a_star_grid_with_wall()
+{
+	constexpr int size = walled_grid::size;
+	const utils::coords target{ size - 1, 0 };
+	const auto [path, cost] = utils::a_star(utils::coords{ 0,0 }, [&target](utils::coords c) { return c == target; }, walled_grid::get_next_nodes,
+		[](utils::coords, utils::coords) { return 1; }, [&target](utils::coords c) { return c.manhatten_distance(target); },
+		std::equal_to<utils::coords>{}, walled_grid::get_hash, size * size);
+	AdventCheck(path.size() == static_cast<std::size_t>(cost) + 1u);
+	return static_cast<int64_t>(cost);
+}
+
+ResultType a_star_bidirectional_directed()
+{
+	// As a_star_weighted_decrease_key, so the backward search has to follow the edges against their direction.
+	auto get_next_nodes = [](int node)
+		{
+			switch (node)
+			{
+			case 0: return std::vector<int>{ 1, 2 };
+			case 1: return std::vector<int>{ 3 };
+			case 2: return std::vector<int>{ 1 };
+			default: return std::vector<int>{};
+			}
+		};
+	auto get_previous_nodes = [](int node)
+		{
+			switch (node)
+			{
+			case 1: return std::vector<int>{ 0, 2 };
+			case 2: return std::vector<int>{ 0 };
+			case 3: return std::vector<int>{ 1 };
+			default: return std::vector<int>{};
+			}
+		};
+	auto get_cost = [](int from, int to) { return (from == 0 && to == 1) ? 10 : 1; };
+	const auto [path, cost] = utils::a_star_bidirectional(0, 3, get_next_nodes, get_previous_nodes, get_cost, std::equal_to<int>{});
+	return std::to_string(cost) + ':' + utils::testing::print_container(path);
+}
+
+ResultType a_star_bidirectional_grid_with_wall()
+{
+	constexpr int size = walled_grid::size;
+	const utils::coords start{ 0, 0 };
+	const utils::coords target{ size - 1, 0 };
+	const auto [path, cost] = utils::a_star_bidirectional(start, target, walled_grid::get_next_nodes, walled_grid::get_next_nodes,
+		[](utils::coords, utils::coords) { return 1; }, std::equal_to<utils::coords>{}, walled_grid::get_hash, size * size);
+	AdventCheck(path.size() == static_cast<std::size_t>(cost) + 1u);
+	AdventCheck(path.front() == start);
+	AdventCheck(path.back() == target);
+	for (std::size_t i = 1u; i < path.size(); ++i)
+	{
+		AdventCheck(path[i - 1].manhatten_distance(path[i]) == 1);
+		AdventCheck(walled_grid::is_open(path[i]));
+	}
+	return static_cast<int64_t>(cost);
+}
+
+ResultType a_star_multi_target_costs()
+{
+	// A line 0-1-2-3, and 9 which nothing leads to.
+	auto get_next_nodes = [](int node)
+		{
+			std::vector<int> result;
+			if (node > 0 && node < 4) result.push_back(node - 1);
+			if (node < 3) result.push_back(node + 1);
+			return result;
+		};
+	const std::vector<int> targets{ 3, 0, 1, 9, 3 };
+	const auto results = utils::a_star_multi_target(0, targets, get_next_nodes, [](int, int) { return 1; }, std::equal_to<int>{});
+	std::vector<std::string> costs;
+	for (const auto& [path, cost] : results)
+	{
+		if (path.empty())
+		{
+			costs.push_back("unreachable");
+			continue;
+		}
+		AdventCheck(path.size() == static_cast<std::size_t>(cost) + 1u);
+		costs.push_back(std::to_string(cost));
+	}
+	return utils::testing::print_container(costs);
+}
+
+ResultType a_star_workspace_reuse()
+{
+	// The first and last searches are the same, so reusing the memory mustn't change anything.
+	constexpr int size = walled_grid::size;
+	const utils::coords start{ 0, 0 };
+	utils::a_star_workspace<utils::coords, int> workspace;
+	auto search = [&](utils::coords target)
+		{
+			const auto [path, cost] = workspace.search(start, [&target](utils::coords c) { return c == target; }, walled_grid::get_next_nodes,
+				[](utils::coords, utils::coords) { return 1; }, [&target](utils::coords c) { return c.manhatten_distance(target); },
+				std::equal_to<utils::coords>{}, walled_grid::get_hash);
+			AdventCheck(path.size() == static_cast<std::size_t>(cost) + 1u);
+			AdventCheck(path.front() == start);
+			AdventCheck(path.back() == target);
+			return std::to_string(cost);
+		};
+	const std::string first = search(utils::coords{ size - 1, 0 });
+	const std::string second = search(utils::coords{ 0, size - 1 });
+	const std::string third = search(utils::coords{ size - 1, 0 });
+	return first + ':' + second + ':' + third;
+}
+
+ResultType node_arena_stable_and_reset()
+{
+	utils::node_arena<std::string, 16> arena;
+	const std::size_t first = arena.emplace_back("first");
+	const std::string* first_address = &arena[first];
+	for (int i = 1; i < 100; ++i)
+	{
+		arena.emplace_back(std::to_string(i));
+	}
+	AdventCheck(&arena[first] == first_address);
+	AdventCheck(arena[first] == "first");
+	AdventCheck(arena[99] == "99");
+	const std::size_t size = arena.size();
+	const std::size_t capacity = arena.capacity();
+	arena.reset();
+	std::string result = std::to_string(size) + ':' + std::to_string(capacity) + ':' + std::to_string(arena.size()) + ':' + std::to_string(arena.capacity());
+	// Reusing the first block.
+	const std::size_t again = arena.emplace_back("again");
+	AdventCheck(&arena[again] == first_address);
+	return result;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,109 @@
+#include "utils/tests/bucket_dijkstra_tests.h"
+
+#if UTILS_TESTING
+
+#include "utils/bucket_dijkstra.h"
+#include "utils/a_star.h"
+#include "utils/coords.h"
+
+ResultType bucket_queue_ring_wrap()
+{
+	// Four buckets. Priorities 4, 5 and 6 reuse the buckets of 0, 1 and 2.
+	constexpr std::size_t max_priority_step = 3u;
+	utils::bucket_queue<int> queue{ max_priority_step };
+	std::vector<std::string> order;
+	auto pop = [&queue, &order]()
+		{
+			const auto [priority, value] = queue.pop();
+			order.push_back(std::to_string(priority) + ':' + std::to_string(value));
+		};
+	queue.push(0u, 0);
+	queue.push(3u, 1);
+	queue.push(2u, 2);
+	pop();
+	pop();
+	queue.push(5u, 3);
+	pop();
+	queue.push(6u, 4);
+	queue.push(4u, 5);
+	while (!queue.empty())
+	{
+		pop();
+	}
+	return utils::testing::print_container(order);
+}
+
+ResultType bucket_dijkstra_stale_entries()
+{
+	// 0 reaches 1 directly for 5, or through 2 for 2, so 1 is queued twice. It must only be expanded once.
+	std::vector<int> times_expanded(4u, 0);
+	auto get_next_nodes = [&times_expanded](int node)
+		{
+			++times_expanded[static_cast<std::size_t>(node)];
+			switch (node)
+			{
+			case 0: return std::vector<int>{ 1, 2 };
+			case 1: return std::vector<int>{ 3 };
+			case 2: return std::vector<int>{ 1 };
+			default: return std::vector<int>{};
+			}
+		};
+	auto get_cost = [](int from, int to) { return (from == 0 && to == 1) ? 5 : 1; };
+	const auto [path, cost] = utils::bucket_dijkstra(0, [](int node) { return node == 3; }, get_next_nodes, get_cost, std::equal_to<int>{}, 5u);
+	return std::to_string(cost) + ':' + utils::testing::print_container(path) + ':' + std::to_string(times_expanded[1]);
+}
+
+ResultType bucket_dijkstra_unreachable()
+{
+	// A line 0-1-2-3, and 9 which nothing leads to.
+	auto get_next_nodes = [](int node)
+		{
+			std::vector<int> result;
+			if (node > 0 && node < 4) result.push_back(node - 1);
+			if (node < 3) result.push_back(node + 1);
+			return result;
+		};
+	const auto [path, cost] = utils::bucket_dijkstra(0, [](int node) { return node == 9; }, get_next_nodes, [](int, int) { return 1; }, std::equal_to<int>{}, 1u);
+	return std::to_string(path.size()) + ':' + std::to_string(cost);
+}
+
+ResultType bucket_dijkstra_matches_a_star()
+{
+	// A 20x20 grid where stepping into a cell costs anything from 1 to 9, and every seventh cell is a wall.
+	constexpr int size = 20;
+	constexpr int max_step_cost = 9;
+	auto is_open = [](utils::coords c)
+		{
+			return c.x >= 0 && c.y >= 0 && c.x < size && c.y < size && ((c.x * 3 + c.y * 5) % 7 != 0 || c == utils::coords{ 0,0 });
+		};
+	auto get_next_nodes = [&is_open](utils::coords c)
+		{
+			std::vector<utils::coords> result;
+			for (utils::coords offset : { utils::coords::up(), utils::coords::down(), utils::coords::left(), utils::coords::right() })
+			{
+				if (is_open(c + offset)) result.push_back(c + offset);
+			}
+			return result;
+		};
+	auto get_cost = [](utils::coords, utils::coords to) { return 1 + (to.x * 7 + to.y * 13) % max_step_cost; };
+	auto get_hash = [](utils::coords c) { return static_cast<std::size_t>(c.y) * size + static_cast<std::size_t>(c.x); };
+
+	const utils::coords start{ 0,0 };
+	for (int y = 0; y < size; ++y)
+	{
+		for (int x = 0; x < size; ++x)
+		{
+			const utils::coords target{ x,y };
+			if (!is_open(target)) continue;
+			auto is_target = [&target](utils::coords c) { return c == target; };
+			const auto [expected_path, expected_cost] = utils::a_star(start, is_target, get_next_nodes, get_cost,
+				[&target](utils::coords c) { return c.manhatten_distance(target); }, std::equal_to<utils::coords>{}, get_hash, size * size);
+			const auto [path, cost] = utils::bucket_dijkstra(start, is_target, get_next_nodes, get_cost, std::equal_to<utils::coords>{}, get_hash,
+				static_cast<std::size_t>(max_step_cost), size * size);
+			if (path.empty() != expected_path.empty() || cost != expected_cost) return std::string{ "different" };
+		}
+	}
+	return std::string{ "same" };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,102 @@
+#include "utils/tests/delta_stepping_tests.h"
+
+#if UTILS_TESTING
+
+#include "utils/delta_stepping.h"
+#include "utils/grid_search.h"
+#include "utils/grid.h"
+#include "utils/coords.h"
+
+#include <sstream>
+
+ResultType delta_stepping_matches_dijkstra()
+{
+	// A 60x60 grid where stepping into a cell costs anything from 1 to 20, and every seventh cell is a wall.
+	constexpr int size = 60;
+	using Search = utils::grid_search<int>;
+	Search search{ utils::coords{ size,size } };
+	auto get_step_cost = [](const utils::coords& c) { return 1 + (c.x * 7 + c.y * 13) % 20; };
+	auto is_wall = [](const utils::coords& c) { return (c.x * 3 + c.y * 5) % 7 == 0 && c != utils::coords{ 0,0 }; };
+	auto for_each_move = [&search, &get_step_cost, &is_wall](std::size_t from, auto&& add_move)
+		{
+			for (const utils::coords& next : search.get_location(from).neighbours())
+			{
+				if (search.is_on_grid(next) && !is_wall(next))
+				{
+					add_move(search.get_id(next), get_step_cost(next));
+				}
+			}
+		};
+	search.fill(search.get_id(utils::coords{ 0,0 }), for_each_move);
+	const std::span<const int> expected = search.get_distance_field();
+
+	const std::size_t start = search.get_id(utils::coords{ 0,0 });
+	std::string result;
+	for (const auto& [bucket_width, num_threads] : { std::pair{ 1, 1u }, std::pair{ 1, 4u }, std::pair{ 25, 1u }, std::pair{ 25, 4u } })
+	{
+		const std::vector<int> distances = utils::delta_stepping<int>(search.num_states(), std::span<const std::size_t>{ &start, 1u }, for_each_move,
+			bucket_width, num_threads);
+		if (!result.empty()) result += ':';
+		result += std::ranges::equal(distances, expected) ? "same" : "different";
+	}
+	return result;
+}
+
+ResultType delta_stepping_grid_distances()
+{
+	std::istringstream input{
+		".....\n"
+		".###.\n"
+		".#E#.\n"
+		".#.#.\n"
+		"S#...\n" };
+	const utils::grid<char> grid = utils::grid_helpers::build(input);
+	auto cost_fn = [](utils::coords from, char, utils::coords to, char to_node) -> std::optional<int>
+		{
+			if (to_node == '#' || from.manhatten_distance(to) != 1) return std::nullopt;
+			return 1;
+		};
+	const utils::coords start = *grid.get_coordinates('S');
+	const utils::grid<int> distances = utils::delta_stepping<int>(grid, std::span<const utils::coords>{ &start, 1u }, cost_fn, 2, 2u);
+	const int to_wall = distances[*grid.get_coordinates('#')];
+	return std::to_string(distances[*grid.get_coordinates('E')]) + ':' + (to_wall == utils::delta_stepping_unreachable<int> ? "unreachable" : std::to_string(to_wall));
+}
+
+ResultType delta_stepping_long_chain()
+{
+	// States 0 to 5000 in a line, costing 1 per step apart from the one into state 100, which costs 5000.
+	constexpr std::size_t num_states = 5001u;
+	auto for_each_move = [](std::size_t from, auto&& add_move)
+		{
+			if (from + 1u < num_states)
+			{
+				add_move(from + 1u, from + 1u == 100u ? 5000 : 1);
+			}
+		};
+	const std::size_t start = 0u;
+	const std::vector<int> distances = utils::delta_stepping<int>(num_states, std::span<const std::size_t>{ &start, 1u }, for_each_move, 1, 1u);
+	return std::to_string(distances.back()) + ':' + std::to_string(distances[100u]);
+}
+
+ResultType delta_stepping_bucket_overflow()
+{
+	auto for_each_move = [](std::size_t from, auto&& add_move)
+		{
+			if (from == 0u)
+			{
+				add_move(std::size_t{ 1u }, 1e30f);
+			}
+		};
+	const std::size_t start = 0u;
+	try
+	{
+		utils::delta_stepping<float>(2u, std::span<const std::size_t>{ &start, 1u }, for_each_move, 1.0f, 1u);
+	}
+	catch (const advent::test_failed&)
+	{
+		return std::string{ "rejected" };
+	}
+	return std::string{ "accepted" };
+}
+
+#endif
\ No newline at end of file
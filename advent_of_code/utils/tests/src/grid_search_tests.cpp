@@ -0,0 +1,231 @@
+#include "utils/tests/grid_search_tests.h"
+
+#if UTILS_TESTING
+
+#include "utils/grid_search.h"
+#include "utils/jump_point_search.h"
+#include "utils/incremental_grid_search.h"
+#include "utils/grid_connectivity.h"
+#include "utils/grid.h"
+#include "utils/coords.h"
+
+#include <sstream>
+#include <random>
+
+ResultType grid_search_distance_field_layers()
+{
+	// A 5x5 open grid. Moving costs 1 and turning costs 2, so there's one layer per direction.
+	using Search = utils::grid_search<int>;
+	Search search{ utils::coords{ 5,5 }, 4u };
+	auto for_each_move = [&search](Search::state_id from, auto&& add_move)
+		{
+			const utils::coords location = search.get_location(from);
+			const auto dir = static_cast<utils::direction>(search.get_layer(from));
+			const utils::coords next = location + utils::coords::dir(dir);
+			if (search.is_on_grid(next))
+			{
+				add_move(search.get_id(next, search.get_layer(from)), 1);
+			}
+			for (utils::turn_dir turn : { utils::turn_dir::clockwise, utils::turn_dir::anticlockwise })
+			{
+				add_move(search.get_id(location, static_cast<std::size_t>(utils::rotate(dir, turn))), 2);
+			}
+		};
+	search.fill(search.get_id(utils::coords{ 0,0 }, static_cast<std::size_t>(utils::direction::right)), for_each_move);
+	const utils::coords far_corner{ 4,4 };
+	const int corner_any_direction = search.get_cell_cost(far_corner);
+	const int corner_facing_down = search.get_cost(search.get_id(far_corner, static_cast<std::size_t>(utils::direction::down)));
+	const std::size_t num_unreachable = std::ranges::count(search.get_distance_field(), Search::unreachable);
+	AdventCheck(search.get_path(search.get_id(far_corner)).size() >= 9u);
+	return std::to_string(corner_any_direction) + ':' + std::to_string(corner_facing_down) + ':' + std::to_string(num_unreachable);
+}
+
+ResultType grid_get_path_around_walls()
+{
+	std::istringstream input{
+		".....\n"
+		".###.\n"
+		".#E#.\n"
+		".#.#.\n"
+		"S#...\n" };
+	const utils::grid<char> grid = utils::grid_helpers::build(input);
+	const utils::coords start = *grid.get_coordinates('S');
+	const utils::coords end = *grid.get_coordinates('E');
+	auto cost_fn = [](utils::coords from, char, utils::coords to, char to_node) -> std::optional<float>
+		{
+			if (to_node == '#' || from.manhatten_distance(to) != 1) return std::nullopt;
+			return 1.0f;
+		};
+	const auto path = grid.get_path(start, end, cost_fn);
+	AdventCheck(!path.empty() && path.front() == end && path.back() == start);
+	return path.size();
+}
+
+ResultType grid_get_path_default_cost()
+{
+	std::istringstream input{
+		".....\n"
+		".###.\n"
+		".#E#.\n"
+		".#.#.\n"
+		"S#...\n" };
+	const utils::grid<char> grid = utils::grid_helpers::build(input);
+	const utils::coords start = *grid.get_coordinates('S');
+	const utils::coords end = *grid.get_coordinates('E');
+	const auto to_end = grid.get_path(start, end);
+	const auto to_any_end = grid.get_path(start, [](utils::coords, char node) { return node == 'E'; });
+	AdventCheck(!to_end.empty() && to_end.front() == end && to_end.back() == start);
+	AdventCheck(!to_any_end.empty() && to_any_end.front() == end && to_any_end.back() == start);
+	return std::to_string(to_end.size()) + ':' + std::to_string(to_any_end.size());
+}
+
+ResultType jump_point_search_paths()
+{
+	std::istringstream input{
+		".....\n"
+		".###.\n"
+		".#E#.\n"
+		".#.#.\n"
+		"S#...\n" };
+	const utils::grid<char> grid = utils::grid_helpers::build(input);
+	auto is_wall = [&grid](utils::coords c) { return grid[c] == '#'; };
+	utils::jump_point_search<false> orthogonal{ grid.get_max_point() };
+	const auto around_walls = orthogonal.find_path(*grid.get_coordinates('S'), *grid.get_coordinates('E'), is_wall);
+
+	// Across an open grid, diagonals cut the number of steps.
+	auto nothing_blocked = [](utils::coords) { return false; };
+	utils::jump_point_search<false> open_orthogonal{ utils::coords{ 6,6 } };
+	utils::jump_point_search<true> open_diagonal{ utils::coords{ 6,6 } };
+	const auto straight_path = open_orthogonal.find_path(utils::coords{ 0,0 }, utils::coords{ 3,5 }, nothing_blocked);
+	const auto diagonal_path = open_diagonal.find_path(utils::coords{ 0,0 }, utils::coords{ 3,5 }, nothing_blocked);
+	AdventCheck(diagonal_path.back() == (utils::coords{ 3,5 }));
+	return std::to_string(orthogonal.get_path_cost(around_walls)) + ':' + std::to_string(straight_path.size()) + ':' + std::to_string(diagonal_path.size());
+}
+
+ResultType incremental_grid_search_block_unblock()
+{
+	// A 5x5 grid from (0,0) to (4,0), with a wall going up x == 2.
+	utils::incremental_grid_search search{ utils::coords{ 5,5 }, utils::coords{ 0,0 }, utils::coords{ 4,0 } };
+	auto get_distance = [&search]()
+		{
+			const auto distance = search.get_distance();
+			return distance == utils::incremental_grid_search::unreachable ? std::string{ "unreachable" } : std::to_string(distance);
+		};
+	std::string result = get_distance();
+	for (int y : { 0, 1, 2, 3 })
+	{
+		search.block(utils::coords{ 2,y });
+	}
+	result += ':' + get_distance();
+	search.unblock(utils::coords{ 2,2 });
+	result += ':' + get_distance();
+	search.block(utils::coords{ 2,2 });
+	search.block(utils::coords{ 2,4 });
+	result += ':' + get_distance();
+	return result;
+}
+
+ResultType incremental_grid_search_matches_bfs()
+{
+	// Small grids with random cells blocked and unblocked one at a time, start and goal included. After every
+	// change the distance must match a search from scratch.
+	auto get_bfs_distance = [](utils::coords size, const std::vector<bool>& blocked, utils::coords start, utils::coords goal)
+		{
+			auto get_id = [&size](utils::coords c) { return static_cast<std::size_t>(c.y * size.x + c.x); };
+			std::vector<utils::incremental_grid_search::cost_type> distances(blocked.size(), utils::incremental_grid_search::unreachable);
+			if (blocked[get_id(start)]) return utils::incremental_grid_search::unreachable;
+			std::vector<utils::coords> frontier{ start };
+			distances[get_id(start)] = 0;
+			for (std::size_t i = 0u; i < frontier.size(); ++i)
+			{
+				const utils::coords current = frontier[i];
+				for (const utils::coords& next : current.neighbours())
+				{
+					if (next.x < 0 || next.y < 0 || next.x >= size.x || next.y >= size.y) continue;
+					const std::size_t next_id = get_id(next);
+					if (blocked[next_id] || distances[next_id] != utils::incremental_grid_search::unreachable) continue;
+					distances[next_id] = distances[get_id(current)] + 1;
+					frontier.push_back(next);
+				}
+			}
+			return distances[get_id(goal)];
+		};
+
+	std::mt19937 random{ 20241225u };
+	auto random_int = [&random](int low, int high) { return std::uniform_int_distribution<int>{ low, high }(random); };
+	for (int trial = 0; trial < 50; ++trial)
+	{
+		const utils::coords size{ random_int(2, 8), random_int(2, 8) };
+		auto random_cell = [&random_int, &size]() { return utils::coords{ random_int(0, size.x - 1), random_int(0, size.y - 1) }; };
+		const utils::coords start = random_cell();
+		const utils::coords goal = random_cell();
+		utils::incremental_grid_search search{ size, start, goal };
+		std::vector<bool> blocked(static_cast<std::size_t>(size.x * size.y), false);
+		for (int change = 0; change < 100; ++change)
+		{
+			const utils::coords cell = random_cell();
+			const std::size_t cell_id = static_cast<std::size_t>(cell.y * size.x + cell.x);
+			// Mostly blocking, so the grid fills up enough to cut the goal off at times.
+			const bool block = random_int(0, 2) > 0;
+			blocked[cell_id] = block;
+			if (block)
+			{
+				search.block(cell);
+			}
+			else
+			{
+				search.unblock(cell);
+			}
+			if (search.get_distance() != get_bfs_distance(size, blocked, start, goal))
+			{
+				return "different on trial " + std::to_string(trial) + " after change " + std::to_string(change);
+			}
+		}
+	}
+	return std::string{ "same" };
+}
+
+namespace
+{
+	std::string to_string(const utils::grid_disconnection& disconnection)
+	{
+		switch (disconnection.result)
+		{
+		case utils::grid_disconnection::outcome::never_disconnected:
+			return "never";
+		case utils::grid_disconnection::outcome::disconnected_at:
+			return std::to_string(disconnection.insertion_idx);
+		case utils::grid_disconnection::outcome::initially_disconnected:
+			return "initially";
+		}
+		AdventUnreachable();
+		return std::string{};
+	}
+}
+
+ResultType grid_connectivity_first_blocking_cell()
+{
+	// Blocking both orthogonal neighbours of the start cuts it off, unless it can step diagonally.
+	const std::vector<utils::coords> insertions{ utils::coords{ 1,0 }, utils::coords{ 0,1 }, utils::coords{ 2,0 } };
+	auto find_first = [&insertions](utils::grid_adjacency adjacency)
+		{
+			return to_string(utils::find_first_disconnecting_insertion(utils::coords{ 3,3 },
+				utils::coords{ 0,0 }, utils::coords{ 2,2 }, insertions, adjacency));
+		};
+	return find_first(utils::grid_adjacency::orthogonal) + ':' + find_first(utils::grid_adjacency::with_diagonals);
+}
+
+ResultType grid_connectivity_disconnected_from_the_start()
+{
+	// A wall all the way down x == 1 already separates start and finish, with or without any insertions.
+	auto find_first = [](std::span<const utils::coords> insertions)
+		{
+			return to_string(utils::find_first_disconnecting_insertion(utils::coords{ 3,3 },
+				utils::coords{ 0,0 }, utils::coords{ 2,2 }, insertions, utils::grid_adjacency::orthogonal,
+				[](const utils::coords& c) { return c.x == 1; }));
+		};
+	const std::vector<utils::coords> insertions{ utils::coords{ 0,1 }, utils::coords{ 2,1 } };
+	return find_first({}) + ':' + find_first(insertions);
+}
+
+#endif
\ No newline at end of file
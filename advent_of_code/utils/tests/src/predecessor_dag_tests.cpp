@@ -0,0 +1,52 @@
+#include "utils/tests/predecessor_dag_tests.h"
+
+#if UTILS_TESTING
+
+#include "utils/predecessor_dag.h"
+#include "utils/coords.h"
+
+ResultType predecessor_dag_open_grid()
+{
+	// A 3x3 open grid from one corner to the other: there are 6 shortest paths, covering all 9 cells.
+	constexpr int size = 3;
+	auto get_id = [](utils::coords c) { return static_cast<std::size_t>(c.y * size + c.x); };
+	auto for_each_move = [&get_id](std::size_t from, auto&& add_move)
+		{
+			const utils::coords location{ static_cast<int>(from) % size, static_cast<int>(from) / size };
+			for (const utils::coords& next : location.neighbours())
+			{
+				if (next.x >= 0 && next.y >= 0 && next.x < size && next.y < size)
+				{
+					add_move(get_id(next), 1);
+				}
+			}
+		};
+	const std::size_t end_id = get_id(utils::coords{ size - 1, size - 1 });
+	const utils::optimal_paths<int> paths = utils::find_all_optimal_paths<int>(size * size, get_id(utils::coords{ 0,0 }), for_each_move,
+		[end_id](std::size_t id) { return id == end_id; });
+	const std::vector<bool> on_paths = paths.get_states_on_paths();
+	return std::to_string(paths.cost) + ':' + std::to_string(paths.count_paths()) + ':' + std::to_string(std::ranges::count(on_paths, true));
+}
+
+ResultType predecessor_dag_count_saturates()
+{
+	// 70 diamonds in a row double the number of paths each time, so there are 2^70.
+	constexpr std::size_t num_diamonds = 70u;
+	utils::predecessor_dag dag{ 3u * num_diamonds + 1u };
+	dag.finalise(0u);
+	for (std::size_t i = 0u; i < num_diamonds; ++i)
+	{
+		const std::size_t first = 3u * i;
+		dag.set_predecessor(first + 1u, first);
+		dag.set_predecessor(first + 2u, first);
+		dag.finalise(first + 1u);
+		dag.finalise(first + 2u);
+		dag.set_predecessor(first + 3u, first + 1u);
+		dag.add_predecessor(first + 3u, first + 2u);
+		dag.finalise(first + 3u);
+	}
+	const std::size_t end = 3u * num_diamonds;
+	return dag.count_paths_to(std::span<const std::size_t>{ &end, 1u });
+}
+
+#endif
\ No newline at end of file
@@ -23,9 +23,9 @@ namespace utils::testing
 	std::vector<verification_test>& get_all_tests();
 	struct TestAdder
 	{
-		TestAdder(std::string test_name, TestFunc test_func, std::string expected_result)
+		TestAdder(std::string_view test_name, TestFunc test_func, std::string_view expected_result)
 		{
-			get_all_tests().push_back(make_test(std::move(test_name), std::move(test_func), std::move(expected_result)));
+			get_all_tests().push_back(make_test(test_name, test_func, expected_result));
 		}
 	};
 
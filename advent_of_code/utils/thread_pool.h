@@ -0,0 +1,186 @@
+#pragma once
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <deque>
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <exception>
+#include <utility>
+
+#include "advent/advent_assert.h"
+
+namespace utils
+{
+	// A fixed-size pool of worker threads.
+	// Each worker owns a queue of tasks. It takes work from the front of its own queue and, once that is empty,
+	// steals from the back of the other workers' queues. Tasks are handed out round-robin in submission order,
+	// so submitting the most expensive tasks first means they are started first.
+	class thread_pool
+	{
+	public:
+		using task = std::function<void()>;
+	private:
+		struct worker_queue
+		{
+			std::mutex mutex;
+			std::deque<task> tasks;
+		};
+
+		std::vector<std::unique_ptr<worker_queue>> m_queues;
+		std::vector<std::thread> m_threads;
+
+		std::mutex m_wake_mutex;
+		std::condition_variable m_wake_signal;
+		std::condition_variable m_done_signal;
+		std::size_t m_queued = 0u;
+		std::size_t m_pending = 0u;
+		std::size_t m_next_queue = 0u;
+		bool m_stopping = false;
+		// The first exception to escape a task. wait() rethrows it.
+		std::exception_ptr m_task_exception;
+
+		bool try_pop_front(std::size_t queue_idx, task& out)
+		{
+			worker_queue& queue = *m_queues[queue_idx];
+			std::scoped_lock lock{ queue.mutex };
+			if (queue.tasks.empty()) return false;
+			out = std::move(queue.tasks.front());
+			queue.tasks.pop_front();
+			return true;
+		}
+
+		bool try_steal(std::size_t thief_idx, task& out)
+		{
+			for (std::size_t offset = 1u; offset < m_queues.size(); ++offset)
+			{
+				worker_queue& victim = *m_queues[(thief_idx + offset) % m_queues.size()];
+				std::scoped_lock lock{ victim.mutex };
+				if (victim.tasks.empty()) continue;
+				out = std::move(victim.tasks.back());
+				victim.tasks.pop_back();
+				return true;
+			}
+			return false;
+		}
+
+		void worker_loop(std::size_t worker_idx)
+		{
+			while (true)
+			{
+				{
+					std::unique_lock lock{ m_wake_mutex };
+					m_wake_signal.wait(lock, [this]() { return m_stopping || m_queued > 0u; });
+					if (m_queued == 0u)
+					{
+						return;
+					}
+					// Claim one of the queued tasks before looking for it. Tasks are only counted once they are in
+					// a queue, and every other claimant takes just one, so there's always one left to find.
+					--m_queued;
+				}
+
+				task next_task;
+				while (!try_pop_front(worker_idx, next_task) && !try_steal(worker_idx, next_task))
+				{
+				}
+				std::exception_ptr task_exception;
+				try
+				{
+					next_task();
+				}
+				catch (...)
+				{
+					task_exception = std::current_exception();
+				}
+
+				std::scoped_lock lock{ m_wake_mutex };
+				if (task_exception && !m_task_exception)
+				{
+					m_task_exception = std::move(task_exception);
+				}
+				--m_pending;
+				if (m_pending == 0u)
+				{
+					m_done_signal.notify_all();
+				}
+			}
+		}
+
+		void wait_for_tasks()
+		{
+			std::unique_lock lock{ m_wake_mutex };
+			m_done_signal.wait(lock, [this]() { return m_pending == 0u; });
+		}
+	public:
+		explicit thread_pool(std::size_t num_threads)
+		{
+			AdventCheck(num_threads > 0u);
+			m_queues.reserve(num_threads);
+			for (std::size_t i = 0u; i < num_threads; ++i)
+			{
+				m_queues.push_back(std::make_unique<worker_queue>());
+			}
+			m_threads.reserve(num_threads);
+			for (std::size_t i = 0u; i < num_threads; ++i)
+			{
+				m_threads.emplace_back([this, i]() { worker_loop(i); });
+			}
+		}
+
+		thread_pool(const thread_pool&) = delete;
+		thread_pool& operator=(const thread_pool&) = delete;
+
+		// Any exception from a task that nobody called wait() for is dropped.
+		~thread_pool()
+		{
+			wait_for_tasks();
+			{
+				std::scoped_lock lock{ m_wake_mutex };
+				m_stopping = true;
+			}
+			m_wake_signal.notify_all();
+			for (std::thread& t : m_threads)
+			{
+				t.join();
+			}
+		}
+
+		std::size_t size() const noexcept { return m_threads.size(); }
+
+		void submit(task new_task)
+		{
+			{
+				std::scoped_lock lock{ m_wake_mutex };
+				worker_queue& queue = *m_queues[m_next_queue];
+				m_next_queue = (m_next_queue + 1u) % m_queues.size();
+				{
+					std::scoped_lock queue_lock{ queue.mutex };
+					queue.tasks.push_back(std::move(new_task));
+				}
+				++m_queued;
+				++m_pending;
+			}
+			m_wake_signal.notify_one();
+		}
+
+		// Blocks until every submitted task has finished. The calling thread sleeps on a condition variable
+		// rather than spinning. If a task threw, the other tasks still run, and the first exception is rethrown here.
+		void wait()
+		{
+			wait_for_tasks();
+			std::exception_ptr task_exception;
+			{
+				std::scoped_lock lock{ m_wake_mutex };
+				task_exception = std::exchange(m_task_exception, nullptr);
+			}
+			if (task_exception)
+			{
+				std::rethrow_exception(task_exception);
+			}
+		}
+	};
+}